@@ -0,0 +1,251 @@
+/******************************************************************************
+ * File Name:   cfg_snapshot.c
+ *
+ * Description: This file provides the start-up configuration register snapshot
+ * hash. It has no PDL dependency, so it is also built on a host
+ * (tools/cfg_snapshot_sim.c).
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+#include <stddef.h>
+#include "cfg_snapshot.h"
+
+/*******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+static uint32_t Cfg_Snapshot_HashWord(uint32_t hash, uint32_t word);
+static uint32_t Cfg_Snapshot_RecordCheck(const cfg_snapshot_record_t *record);
+
+/*******************************************************************************
+ * Function Definitions
+ *******************************************************************************/
+
+/*****************************************************************************
+ * Function Name: Cfg_Snapshot_HashWord
+ ******************************************************************************
+ * Summary:
+ * Adds the four bytes of a word, LSB first, to an FNV-1a hash.
+ *
+ * Parameters:
+ *  hash : Hash so far
+ *  word : Word to add
+ *
+ * Return:
+ *  uint32_t : Updated hash
+ *****************************************************************************/
+static uint32_t Cfg_Snapshot_HashWord(uint32_t hash, uint32_t word)
+{
+    for (uint32_t i = 0u; i < 4u; i++)
+    {
+        hash ^= (word >> (i * 8u)) & 0xFFu;
+        hash *= CFG_SNAPSHOT_FNV_PRIME;
+    }
+    return hash;
+}
+
+/*****************************************************************************
+ * Function Name: Cfg_Snapshot_RecordCheck
+ ******************************************************************************
+ * Summary:
+ * Calculates the check value of a snapshot record.
+ *
+ * Parameters:
+ *  record : Pointer to the record
+ *
+ * Return:
+ *  uint32_t : Check value
+ *****************************************************************************/
+static uint32_t Cfg_Snapshot_RecordCheck(const cfg_snapshot_record_t *record)
+{
+    uint32_t hash = CFG_SNAPSHOT_FNV_BASIS;
+
+    hash = Cfg_Snapshot_HashWord(hash, record->magic);
+    hash = Cfg_Snapshot_HashWord(hash, ((uint32_t)record->count << 16u) | record->version);
+    hash = Cfg_Snapshot_HashWord(hash, record->hash);
+    hash = Cfg_Snapshot_HashWord(hash, record->writes);
+
+    return hash;
+}
+
+/*****************************************************************************
+ * Function Name: Cfg_Snapshot_Begin
+ ******************************************************************************
+ * Summary:
+ * Starts an incremental hash over a register table.
+ *
+ * Parameters:
+ *  ctx   : Hash context
+ *  regs  : Register addresses
+ *  count : Number of registers
+ *  seed  : Value hashed before the registers, for example an image identifier
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+void Cfg_Snapshot_Begin(cfg_snapshot_ctx_t *ctx, const volatile uint32_t * const *regs, uint16_t count,
+                        uint32_t seed)
+{
+    ctx->regs = regs;
+    ctx->count = count;
+    ctx->next = 0u;
+    ctx->hash = Cfg_Snapshot_HashWord(CFG_SNAPSHOT_FNV_BASIS, seed);
+}
+
+/*****************************************************************************
+ * Function Name: Cfg_Snapshot_Step
+ ******************************************************************************
+ * Summary:
+ * Hashes the next registers of the table.
+ *
+ * Parameters:
+ *  ctx      : Hash context
+ *  max_regs : Most registers to read in this step
+ *
+ * Return:
+ *  bool : true when all registers are hashed, ctx->hash is then final
+ *****************************************************************************/
+bool Cfg_Snapshot_Step(cfg_snapshot_ctx_t *ctx, uint16_t max_regs)
+{
+    uint16_t end = ctx->count;
+
+    if ((ctx->count - ctx->next) > max_regs)
+    {
+        end = (uint16_t)(ctx->next + max_regs);
+    }
+
+    for (; ctx->next < end; ctx->next++)
+    {
+        ctx->hash = Cfg_Snapshot_HashWord(ctx->hash, *ctx->regs[ctx->next]);
+    }
+
+    return (ctx->next >= ctx->count);
+}
+
+/*****************************************************************************
+ * Function Name: Cfg_Snapshot_Hash
+ ******************************************************************************
+ * Summary:
+ * Hashes a complete register table.
+ *
+ * Parameters:
+ *  regs  : Register addresses
+ *  count : Number of registers
+ *  seed  : Value hashed before the registers
+ *
+ * Return:
+ *  uint32_t : Hash
+ *****************************************************************************/
+uint32_t Cfg_Snapshot_Hash(const volatile uint32_t * const *regs, uint16_t count, uint32_t seed)
+{
+    cfg_snapshot_ctx_t ctx;
+
+    Cfg_Snapshot_Begin(&ctx, regs, count, seed);
+    (void)Cfg_Snapshot_Step(&ctx, count);
+
+    return ctx.hash;
+}
+
+/*****************************************************************************
+ * Function Name: Cfg_Snapshot_MakeRecord
+ ******************************************************************************
+ * Summary:
+ * Fills a snapshot record including its check value.
+ *
+ * Parameters:
+ *  record  : Record to fill
+ *  version : Register table version
+ *  count   : Number of registers
+ *  hash    : Hash of the registers
+ *  writes  : Number of snapshot writes including this one
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+void Cfg_Snapshot_MakeRecord(cfg_snapshot_record_t *record, uint16_t version, uint16_t count, uint32_t hash,
+                             uint32_t writes)
+{
+    record->magic = CFG_SNAPSHOT_MAGIC;
+    record->version = version;
+    record->count = count;
+    record->hash = hash;
+    record->writes = writes;
+    record->check = Cfg_Snapshot_RecordCheck(record);
+}
+
+/*****************************************************************************
+ * Function Name: Cfg_Snapshot_IsValid
+ ******************************************************************************
+ * Summary:
+ * Checks the magic number and check value of a snapshot record. Erased and
+ * corrupted records are reported invalid.
+ *
+ * Parameters:
+ *  record : Pointer to the record
+ *
+ * Return:
+ *  bool : true if the record is valid
+ *****************************************************************************/
+bool Cfg_Snapshot_IsValid(const cfg_snapshot_record_t *record)
+{
+    return (CFG_SNAPSHOT_MAGIC == record->magic) && (record->check == Cfg_Snapshot_RecordCheck(record));
+}
+
+/*****************************************************************************
+ * Function Name: Cfg_Snapshot_Matches
+ ******************************************************************************
+ * Summary:
+ * Checks whether a stored snapshot record describes the live registers.
+ *
+ * Parameters:
+ *  record  : Stored record
+ *  version : Register table version
+ *  count   : Number of registers
+ *  hash    : Hash of the live registers
+ *
+ * Return:
+ *  bool : true if the snapshot does not need to be saved again
+ *****************************************************************************/
+bool Cfg_Snapshot_Matches(const cfg_snapshot_record_t *record, uint16_t version, uint16_t count, uint32_t hash)
+{
+    return Cfg_Snapshot_IsValid(record) && (version == record->version) && (count == record->count) &&
+           (hash == record->hash);
+}
+
+
+/* [] END OF FILE */
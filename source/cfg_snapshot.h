@@ -0,0 +1,103 @@
+/******************************************************************************
+ * File Name:   cfg_snapshot.h
+ *
+ * Description: This file provides the start-up configuration register snapshot
+ * hash and record. The registers are hashed at boot and checked against this
+ * hash by the periodic test; the record keeps the number of snapshot writes.
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+/*******************************************************************************
+ * Include guard
+ *******************************************************************************/
+#ifndef CFG_SNAPSHOT_H_
+#define CFG_SNAPSHOT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+/* "CFSP" - marks a valid snapshot record */
+#define CFG_SNAPSHOT_MAGIC              (0x50534643UL)
+
+/* 32-bit FNV-1a. Every change confined to one byte changes the hash. */
+#define CFG_SNAPSHOT_FNV_BASIS          (2166136261UL)
+#define CFG_SNAPSHOT_FNV_PRIME          (16777619UL)
+
+/*******************************************************************************
+ * Data Types
+ *******************************************************************************/
+/* Snapshot record, stored in flash next to the register copy */
+typedef struct
+{
+    uint32_t magic;         /* CFG_SNAPSHOT_MAGIC */
+    uint16_t version;       /* Register table version */
+    uint16_t count;         /* Number of registers in the table */
+    uint32_t hash;          /* Hash of the registers */
+    uint32_t writes;        /* Number of snapshot writes */
+    uint32_t check;         /* Hash of the fields above */
+} cfg_snapshot_record_t;
+
+/* Incremental hash over a register table */
+typedef struct
+{
+    const volatile uint32_t * const *regs;
+    uint16_t count;
+    uint16_t next;          /* Next register to hash */
+    uint32_t hash;
+} cfg_snapshot_ctx_t;
+
+/*******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+void Cfg_Snapshot_Begin(cfg_snapshot_ctx_t *ctx, const volatile uint32_t * const *regs, uint16_t count,
+                        uint32_t seed);
+bool Cfg_Snapshot_Step(cfg_snapshot_ctx_t *ctx, uint16_t max_regs);
+uint32_t Cfg_Snapshot_Hash(const volatile uint32_t * const *regs, uint16_t count, uint32_t seed);
+void Cfg_Snapshot_MakeRecord(cfg_snapshot_record_t *record, uint16_t version, uint16_t count, uint32_t hash,
+                             uint32_t writes);
+bool Cfg_Snapshot_IsValid(const cfg_snapshot_record_t *record);
+bool Cfg_Snapshot_Matches(const cfg_snapshot_record_t *record, uint16_t version, uint16_t count, uint32_t hash);
+
+#endif /* CFG_SNAPSHOT_H_ */
+
+
+/* [] END OF FILE */
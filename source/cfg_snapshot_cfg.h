@@ -0,0 +1,93 @@
+/******************************************************************************
+ * File Name:   cfg_snapshot_cfg.h
+ *
+ * Description: This file holds the registers covered by the start-up
+ * configuration register snapshot hash.
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+/*******************************************************************************
+ * Include guard
+ *******************************************************************************/
+#ifndef CFG_SNAPSHOT_CFG_H_
+#define CFG_SNAPSHOT_CFG_H_
+
+#include "fault_journal.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+/* The snapshot record uses the row below the ILO trim record */
+#define CFG_SNAPSHOT_RECORD_ADDR        (FAULT_JOURNAL_BASE + FAULT_JOURNAL_SIZE - (2UL * FAULT_JOURNAL_ROW_SIZE))
+
+/* Increment when CFG_SNAPSHOT_REGS changes, stored in the snapshot record */
+#define CFG_SNAPSHOT_VERSION            (1u)
+
+/* Registers read per slice by the periodic check */
+#define CFG_SNAPSHOT_SLICE_REGS         (4u)
+
+/* Clock configuration registers covered by the hash of the periodic check:
+ * X(register)
+ *
+ * The start-up test and the snapshot save use the register list of the
+ * library, see Start_Up_Test(). Registers that change at run time, such as
+ * the ILO trim, must not be listed here. */
+#define CFG_SNAPSHOT_REGS(X) \
+    X(SRSS_CLK_PATH_SELECT[0])  \
+    X(SRSS_CLK_PATH_SELECT[1])  \
+    X(SRSS_CLK_ROOT_SELECT[0])  \
+    X(SRSS_CLK_ROOT_SELECT[1])  \
+    X(SRSS_CLK_ROOT_SELECT[2])  \
+    X(SRSS_CLK_ROOT_SELECT[3])  \
+    X(SRSS_CLK_SELECT)          \
+    X(SRSS_CLK_FLL_CONFIG)      \
+    X(SRSS_CLK_FLL_CONFIG2)     \
+    X(SRSS_CLK_FLL_CONFIG3)     \
+    X(SRSS_CLK_FLL_CONFIG4)
+
+#define CFG_SNAPSHOT_COUNT_ONE(reg)     + 1u
+#define CFG_SNAPSHOT_REG_COUNT          (0u CFG_SNAPSHOT_REGS(CFG_SNAPSHOT_COUNT_ONE))
+
+/* Slices of one complete periodic check, rounded up */
+#define CFG_SNAPSHOT_SLICES             ((CFG_SNAPSHOT_REG_COUNT + CFG_SNAPSHOT_SLICE_REGS - 1u) / CFG_SNAPSHOT_SLICE_REGS)
+
+#endif /* CFG_SNAPSHOT_CFG_H_ */
+
+
+/* [] END OF FILE */
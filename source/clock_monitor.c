@@ -0,0 +1,322 @@
+/******************************************************************************
+ * File Name:   clock_monitor.c
+ *
+ * Description: This file provides the background clock monitor. It measures
+ * one clock source at a time with the clock measurement counters and moves
+ * on to the next active source when the measurement is done, so the
+ * counters are kept busy without the CPU waiting for them. It has no PDL
+ * dependency; see clock_monitor_cfg.h and self_test.c for the hardware
+ * binding.
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+#include <stddef.h>
+#include <string.h>
+#include "clock_monitor.h"
+#include "clock_monitor_cfg.h"
+
+/*******************************************************************************
+ * Global Variables
+ *******************************************************************************/
+static const clock_monitor_source_t *mon_sources = NULL;
+static const clock_monitor_ops_t    *mon_ops = NULL;
+static clock_monitor_report_t        mon_report = NULL;
+static uint8_t                       mon_count = 0u;
+static uint8_t                       mon_current = 0u;
+static bool                          mon_measuring = false;
+static uint32_t                      mon_started = 0u;
+static uint32_t                      mon_polls = 0u;
+static uint32_t                      mon_refused = 0u;
+static uint32_t                      mon_passes = 0u;
+static clock_monitor_result_t        mon_results[CLOCK_MONITOR_MAX_SOURCES];
+
+/*******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+static void Clock_Monitor_Next(void);
+static void Clock_Monitor_Finish(uint32_t measured);
+
+/*******************************************************************************
+ * Function Definitions
+ *******************************************************************************/
+
+/*****************************************************************************
+ * Function Name: Clock_Monitor_Next
+ ******************************************************************************
+ * Summary:
+ * Moves to the next source, counting complete passes over all sources.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+static void Clock_Monitor_Next(void)
+{
+    mon_current++;
+    if (mon_current >= mon_count)
+    {
+        mon_current = 0u;
+        mon_passes++;
+    }
+}
+
+/*****************************************************************************
+ * Function Name: Clock_Monitor_Finish
+ ******************************************************************************
+ * Summary:
+ * Checks the measured frequency of the current source against its tolerance
+ * band, reports the result and moves to the next source.
+ *
+ * Parameters:
+ *  measured : Measured frequency in Hz, 0 if the measurement failed
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+static void Clock_Monitor_Finish(uint32_t measured)
+{
+    const clock_monitor_source_t *source = &mon_sources[mon_current];
+    clock_monitor_result_t *result = &mon_results[mon_current];
+    int64_t error;
+
+    result->measured = measured;
+    error = (((int64_t)result->measured - (int64_t)result->expected) * 1000000) / (int64_t)result->expected;
+    result->error_ppm = (int32_t)error;
+    result->runs++;
+
+    if ((error <= (int64_t)source->tolerance_ppm) && (error >= -(int64_t)source->tolerance_ppm))
+    {
+        result->state = (uint8_t)CLOCK_MONITOR_PASS;
+    }
+    else
+    {
+        result->state = (uint8_t)CLOCK_MONITOR_FAIL;
+        result->failures++;
+    }
+
+    if (NULL != mon_report)
+    {
+        mon_report(mon_current, result);
+    }
+    Clock_Monitor_Next();
+}
+
+/*****************************************************************************
+ * Function Name: Clock_Monitor_Start
+ ******************************************************************************
+ * Summary:
+ * Starts monitoring a list of clock sources. The measurements are driven by
+ * Clock_Monitor_Poll().
+ *
+ * Parameters:
+ *  sources : Clock sources, must stay valid while monitoring
+ *  count   : Number of sources, at most CLOCK_MONITOR_MAX_SOURCES
+ *  ops     : Measurement counter access
+ *  report  : Called with every completed measurement, may be NULL
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+void Clock_Monitor_Start(const clock_monitor_source_t *sources, uint8_t count,
+                         const clock_monitor_ops_t *ops, clock_monitor_report_t report)
+{
+    mon_sources = sources;
+    mon_count = (count > CLOCK_MONITOR_MAX_SOURCES) ? (uint8_t)CLOCK_MONITOR_MAX_SOURCES : count;
+    mon_ops = ops;
+    mon_report = report;
+    mon_current = 0u;
+    mon_measuring = false;
+    mon_refused = 0u;
+    mon_passes = 0u;
+    (void)memset(mon_results, 0, sizeof(mon_results));
+}
+
+/*****************************************************************************
+ * Function Name: Clock_Monitor_Poll
+ ******************************************************************************
+ * Summary:
+ * Evaluates a completed measurement, or starts the measurement of the next
+ * active source when none is open. Never waits for the counters; when they
+ * are used by someone else, the same source is tried again on the next
+ * call. A measurement that does not complete within
+ * CLOCK_MONITOR_TIMEOUT_CYCLES or CLOCK_MONITOR_TIMEOUT_POLLS is given up
+ * and fails. The counters of a stopped slow clock never complete; the next
+ * start programs counter 1 again, which restarts them. A source whose start
+ * is refused CLOCK_MONITOR_TIMEOUT_POLLS times in a row fails as well, so
+ * counters that cannot be restarted show up as failures instead of
+ * stalling the monitor. Call often, for example from the idle loop and from
+ * the wait loops of other tests.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+void Clock_Monitor_Poll(void)
+{
+    if ((NULL == mon_ops) || (0u == mon_count))
+    {
+        return;
+    }
+
+    if (mon_measuring)
+    {
+        const clock_monitor_source_t *source = &mon_sources[mon_current];
+        uint32_t measured = 0u;
+
+        if (mon_ops->done())
+        {
+            measured = mon_ops->get_freq(source);
+        }
+        else
+        {
+            mon_polls++;
+            if (((mon_ops->now() - mon_started) < CLOCK_MONITOR_TIMEOUT_CYCLES) &&
+                (mon_polls < CLOCK_MONITOR_TIMEOUT_POLLS))
+            {
+                return;
+            }
+
+            /* The source stopped or is far too slow: fails with -1000000 ppm */
+            mon_ops->abort(source);
+        }
+
+        mon_measuring = false;
+        Clock_Monitor_Finish(measured);
+
+        /* The next source starts on the next call, so the ILO trim can take
+         * the counters in between */
+        return;
+    }
+
+    /* Start the next active source, skipping the inactive ones */
+    for (uint8_t i = 0u; i < mon_count; i++)
+    {
+        const clock_monitor_source_t *source = &mon_sources[mon_current];
+        clock_monitor_result_t *result = &mon_results[mon_current];
+
+        result->expected = mon_ops->expected(source);
+        if (0u == result->expected)
+        {
+            result->state = (uint8_t)CLOCK_MONITOR_INACTIVE;
+            Clock_Monitor_Next();
+            continue;
+        }
+
+        mon_measuring = mon_ops->start(source);
+        mon_started = mon_ops->now();
+        mon_polls = 0u;
+
+        if (mon_measuring)
+        {
+            mon_refused = 0u;
+        }
+        else
+        {
+            /* Counters in use, the same source is tried again */
+            mon_refused++;
+            if (mon_refused >= CLOCK_MONITOR_TIMEOUT_POLLS)
+            {
+                /* The counters stay unavailable: fails with -1000000 ppm */
+                mon_refused = 0u;
+                Clock_Monitor_Finish(0u);
+            }
+        }
+        break;
+    }
+}
+
+/*****************************************************************************
+ * Function Name: Clock_Monitor_GetResult
+ ******************************************************************************
+ * Summary:
+ * Returns the result of the last measurement of a source.
+ *
+ * Parameters:
+ *  source : Index into the source list
+ *
+ * Return:
+ *  const clock_monitor_result_t * : Result, NULL for an invalid index
+ *****************************************************************************/
+const clock_monitor_result_t * Clock_Monitor_GetResult(uint8_t source)
+{
+    return (source < mon_count) ? &mon_results[source] : NULL;
+}
+
+/*****************************************************************************
+ * Function Name: Clock_Monitor_GetPasses
+ ******************************************************************************
+ * Summary:
+ * Returns the number of complete passes over all sources.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint32_t : Completed passes
+ *****************************************************************************/
+uint32_t Clock_Monitor_GetPasses(void)
+{
+    return mon_passes;
+}
+
+/*****************************************************************************
+ * Function Name: Clock_Monitor_IsBusy
+ ******************************************************************************
+ * Summary:
+ * Tells other users of the measurement counters that the monitor holds them,
+ * from the start of a measurement until its result is read. Starting the
+ * counters in this time destroys the measurement.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  bool : true while a measurement of the monitor is open
+ *****************************************************************************/
+bool Clock_Monitor_IsBusy(void)
+{
+    return mon_measuring;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,126 @@
+/******************************************************************************
+ * File Name:   clock_monitor.h
+ *
+ * Description: This file provides the background clock monitor. It measures
+ * the clock sources one after the other with the clock measurement
+ * counters and checks each against its tolerance band. The hardware is
+ * accessed through an operations table, so the monitor also runs on a host
+ * with a simulated counter (tools/clock_monitor_sim.c).
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+/*******************************************************************************
+ * Include guard
+ *******************************************************************************/
+#ifndef CLOCK_MONITOR_H_
+#define CLOCK_MONITOR_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+#define CLOCK_MONITOR_MAX_SOURCES       (16u)
+
+/*******************************************************************************
+ * Data Types
+ *******************************************************************************/
+typedef enum
+{
+    CLOCK_MONITOR_NOT_RUN = 0,      /* Not measured yet */
+    CLOCK_MONITOR_PASS,             /* Last measurement within the tolerance */
+    CLOCK_MONITOR_FAIL,             /* Last measurement out of the tolerance */
+    CLOCK_MONITOR_INACTIVE          /* Source not enabled, skipped */
+} clock_monitor_state_t;
+
+/* One monitored clock source */
+typedef struct
+{
+    const char *name;
+    uint32_t    clock;              /* Measured clock (cy_en_meas_clks_t on the target) */
+    uint32_t    tolerance_ppm;      /* Allowed deviation from the expected frequency */
+    bool        slow;               /* Slower than the reference, counts the window itself */
+} clock_monitor_source_t;
+
+/* Access to the measurement counters */
+typedef struct
+{
+    /* Starts a measurement, false if the counters are in use */
+    bool     (*start)(const clock_monitor_source_t *source);
+    /* true when the started measurement completed */
+    bool     (*done)(void);
+    /* Returns the measured frequency in Hz of a completed measurement */
+    uint32_t (*get_freq)(const clock_monitor_source_t *source);
+    /* Returns the configured frequency in Hz, 0 if the source is not active */
+    uint32_t (*expected)(const clock_monitor_source_t *source);
+    /* Returns a free-running CPU cycle count (modulo 2^32) */
+    uint32_t (*now)(void);
+    /* Gives up a started measurement that did not complete in time */
+    void     (*abort)(const clock_monitor_source_t *source);
+} clock_monitor_ops_t;
+
+/* Result of the last measurement of a source */
+typedef struct
+{
+    uint32_t expected;              /* Hz */
+    uint32_t measured;              /* Hz, 0 if the measurement timed out */
+    int32_t  error_ppm;             /* Deviation of measured from expected */
+    uint32_t runs;                  /* Completed measurements */
+    uint32_t failures;              /* Measurements out of the tolerance or timed out */
+    uint8_t  state;                 /* clock_monitor_state_t */
+} clock_monitor_result_t;
+
+/* Called with the result of every completed measurement */
+typedef void (*clock_monitor_report_t)(uint8_t source, const clock_monitor_result_t *result);
+
+/*******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+void Clock_Monitor_Start(const clock_monitor_source_t *sources, uint8_t count,
+                         const clock_monitor_ops_t *ops, clock_monitor_report_t report);
+void Clock_Monitor_Poll(void);
+const clock_monitor_result_t * Clock_Monitor_GetResult(uint8_t source);
+uint32_t Clock_Monitor_GetPasses(void);
+bool Clock_Monitor_IsBusy(void);
+
+#endif /* CLOCK_MONITOR_H_ */
+
+
+/* [] END OF FILE */
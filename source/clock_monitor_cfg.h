@@ -0,0 +1,102 @@
+/******************************************************************************
+ * File Name:   clock_monitor_cfg.h
+ *
+ * Description: This file holds the clock sources checked by the background
+ * clock monitor and their tolerance bands.
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+/*******************************************************************************
+ * Include guard
+ *******************************************************************************/
+#ifndef CLOCK_MONITOR_CFG_H_
+#define CLOCK_MONITOR_CFG_H_
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+/* Reference of all measurements (8 MHz IMO) */
+#define CLOCK_MONITOR_REF_HZ            (8000000UL)
+/* IMO cycles per measurement of a fast clock (128 us). The measured clock
+ * must not count more than 2^24 cycles in this window. */
+#define CLOCK_MONITOR_REF_COUNT         (0x3FFUL)
+/* Cycles of a slow clock per measurement (3.9 ms for the ILO) */
+#define CLOCK_MONITOR_SLOW_COUNT        (0x7FUL)
+
+/* A measurement that did not complete after CLOCK_MONITOR_TIMEOUT_CYCLES CPU
+ * cycles (40 ms at 180 MHz, ten ILO windows) or CLOCK_MONITOR_TIMEOUT_POLLS
+ * polls fails with a measured frequency of 0, so a stopped slow clock is
+ * reported. The cycle counter stops in CPU Sleep; the poll limit bounds the
+ * wait in low-power mode, where every poll follows a wake-up. It is well
+ * above the few thousand polls an idle loop makes during one ILO window. */
+#define CLOCK_MONITOR_TIMEOUT_CYCLES    (7200000UL)
+#define CLOCK_MONITOR_TIMEOUT_POLLS     (10000UL)
+
+/* Frequency of the external crystal, 0 if the ECO is not used */
+#ifndef CLOCK_MONITOR_ECO_HZ
+#define CLOCK_MONITOR_ECO_HZ            (0UL)
+#endif
+
+/* Test index of the first source in reports, one index per source */
+#define CLOCK_MONITOR_TEST_ID           (32u)
+
+/* ILO deviation at which the ILO trim is measured again */
+#define CLOCK_MONITOR_ILO_RECAL_PPM     (20000u)
+
+/* Monitored clock sources:
+ * X(name, measured clock, tolerance in ppm, slow clock)
+ *
+ * The IMO is the reference of all measurements, so the tolerances include
+ * its accuracy (about +/-2 %). The IMO itself is checked against the ILO
+ * by the clock test. Paths and CLK_HF roots that are not enabled, and the
+ * ECO with CLOCK_MONITOR_ECO_HZ 0, are skipped. */
+#define CLOCK_MONITOR_SOURCES(X) \
+    X("ILO",       CY_SYSCLK_MEAS_CLK_ILO,          60000u, true)  \
+    X("ECO",       CY_SYSCLK_MEAS_CLK_ECO,          25000u, false) \
+    X("CLK_PATH0", CY_SYSCLK_MEAS_CLK_PATH_CLK0,    25000u, false) \
+    X("CLK_PATH1", CY_SYSCLK_MEAS_CLK_PATH_CLK1,    25000u, false) \
+    X("CLK_HF0",   CY_SYSCLK_MEAS_CLK_CLK_HF0,      25000u, false) \
+    X("CLK_HF1",   CY_SYSCLK_MEAS_CLK_CLK_HF1,      25000u, false) \
+    X("CLK_HF2",   CY_SYSCLK_MEAS_CLK_CLK_HF2,      25000u, false) \
+    X("CLK_HF3",   CY_SYSCLK_MEAS_CLK_CLK_HF3,      25000u, false)
+
+#endif /* CLOCK_MONITOR_CFG_H_ */
+
+
+/* [] END OF FILE */
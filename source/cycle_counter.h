@@ -0,0 +1,100 @@
+/******************************************************************************
+ * File Name:   cycle_counter.h
+ *
+ * Description: This file provides the CPU cycle counter (DWT CYCCNT) helpers
+ * used to timestamp and measure the self tests.
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+/*******************************************************************************
+ * Include guard
+ *******************************************************************************/
+#ifndef CYCLE_COUNTER_H_
+#define CYCLE_COUNTER_H_
+
+#include "cy_pdl.h"
+
+/*******************************************************************************
+ * Function Definitions
+ *******************************************************************************/
+
+/*****************************************************************************
+ * Function Name: Cycle_Counter_Init
+ ******************************************************************************
+ * Summary:
+ * Enables the DWT cycle counter. The counter runs at the CPU clock and wraps
+ * every 2^32 cycles.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+__STATIC_INLINE void Cycle_Counter_Init(void)
+{
+#if defined (DCB)
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+#else
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#endif
+    DWT->CYCCNT = 0u;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/*****************************************************************************
+ * Function Name: Cycle_Counter_Get
+ ******************************************************************************
+ * Summary:
+ * Returns the current value of the DWT cycle counter.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint32_t : CPU cycles since Cycle_Counter_Init() (modulo 2^32)
+ *****************************************************************************/
+__STATIC_INLINE uint32_t Cycle_Counter_Get(void)
+{
+    return DWT->CYCCNT;
+}
+
+#endif /* CYCLE_COUNTER_H_ */
+
+
+/* [] END OF FILE */
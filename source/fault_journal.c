@@ -0,0 +1,283 @@
+/******************************************************************************
+ * File Name:   fault_journal.c
+ *
+ * Description: This file implements the persistent fault journal. Records are
+ * staged in RAM and programmed one flash row at a time into a ring of rows,
+ * so that every row of the region wears at the same rate.
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+#include <string.h>
+#include "cy_pdl.h"
+#include "fault_journal.h"
+#include "cycle_counter.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+#define FAULT_JOURNAL_ROW(index) \
+        ((const fault_journal_row_t *)(FAULT_JOURNAL_BASE + ((index) * FAULT_JOURNAL_ROW_SIZE)))
+
+/* The journal programs one flash row per journal row */
+typedef char fault_journal_flash_row_check[(CY_FLASH_SIZEOF_ROW == FAULT_JOURNAL_ROW_SIZE) ? 1 : -1];
+
+/*******************************************************************************
+ * Global Variables
+ *******************************************************************************/
+/* RAM staging row. Records are collected here and programmed as one row. */
+static fault_journal_row_t journal_stage;
+
+/* Copy of the staging row that is being programmed, so that records logged
+ * from an interrupt during the flash write are not lost */
+static fault_journal_row_t journal_program_buf;
+
+static uint32_t journal_head_row = FAULT_JOURNAL_NO_ROW;
+static uint32_t journal_next_row = 0u;
+static uint32_t journal_next_seq = 0u;
+static uint16_t journal_boot = 0u;
+static uint32_t journal_dropped = 0u;
+
+/*******************************************************************************
+ * Function Definitions
+ *******************************************************************************/
+
+/*****************************************************************************
+ * Function Name: Fault_Journal_Init
+ ******************************************************************************
+ * Summary:
+ * Locates the journal head in flash, advances the boot number and programs
+ * it in a boot row, a row without records, so that boots which log nothing
+ * are counted as well. A boot row at the head is replaced by the next boot
+ * row and by the first records of its boot, so boots without failures do
+ * not push older records out of the journal. Must be called once at
+ * start-up, before any record is logged. Blocks for one row program time.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+void Fault_Journal_Init(void)
+{
+    uint32_t boot_row;
+
+    journal_head_row = Fault_Journal_FindHead(FAULT_JOURNAL_ROW(0u));
+
+    if (FAULT_JOURNAL_NO_ROW == journal_head_row)
+    {
+        boot_row = 0u;
+        journal_next_seq = 0u;
+        journal_boot = 0u;
+    }
+    else
+    {
+        const fault_journal_row_t *head = FAULT_JOURNAL_ROW(journal_head_row);
+
+        boot_row = (0u == head->hdr.count) ? journal_head_row
+                                           : ((journal_head_row + 1u) % FAULT_JOURNAL_ROW_COUNT);
+        journal_next_seq = head->hdr.seq + 1u;
+        journal_boot = head->hdr.boot + 1u;
+    }
+
+    (void)memset(&journal_program_buf, 0, sizeof(journal_program_buf));
+    Fault_Journal_Seal(&journal_program_buf, journal_next_seq, journal_boot);
+
+    if (CY_FLASH_DRV_SUCCESS == Cy_Flash_WriteRow(FAULT_JOURNAL_BASE + (boot_row * FAULT_JOURNAL_ROW_SIZE),
+                                                  (const uint32_t *)&journal_program_buf))
+    {
+        journal_head_row = boot_row;
+        journal_next_seq++;
+    }
+    else
+    {
+        /* A failed write may have erased the old head */
+        journal_head_row = Fault_Journal_FindHead(FAULT_JOURNAL_ROW(0u));
+    }
+
+    /* The first records of this boot replace its boot row */
+    journal_next_row = boot_row;
+
+    (void)memset(&journal_stage, 0, sizeof(journal_stage));
+    journal_dropped = 0u;
+}
+
+/*****************************************************************************
+ * Function Name: Fault_Journal_Log
+ ******************************************************************************
+ * Summary:
+ * Appends a record to the RAM staging row. Never touches flash, so it is
+ * safe to call from the test path and from interrupts. When the staging row
+ * is full the record is dropped and counted.
+ *
+ * Parameters:
+ *  test_id : Index of the test
+ *  status  : Self test return status
+ *  detail  : Checksum, address or other test specific data
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+void Fault_Journal_Log(uint8_t test_id, uint8_t status, uint32_t detail)
+{
+    const uint32_t timestamp = Cycle_Counter_Get();
+    const uint32_t intr_status = Cy_SysLib_EnterCriticalSection();
+
+    if (journal_stage.hdr.count < FAULT_JOURNAL_RECORDS_PER_ROW)
+    {
+        fault_journal_record_t *record = &journal_stage.records[journal_stage.hdr.count];
+
+        record->timestamp = timestamp;
+        record->detail = detail;
+        record->test_id = test_id;
+        record->status = status;
+        record->reserved = 0u;
+        journal_stage.hdr.count++;
+    }
+    else
+    {
+        journal_dropped++;
+    }
+
+    Cy_SysLib_ExitCriticalSection(intr_status);
+}
+
+/*****************************************************************************
+ * Function Name: Fault_Journal_Flush
+ ******************************************************************************
+ * Summary:
+ * Programs the staged records into the next journal row. Does nothing when
+ * no record is staged, so it can be called from the idle loop. The write
+ * blocks for one row program time and must not be called from the test path.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  bool : false if the flash row could not be programmed
+ *****************************************************************************/
+bool Fault_Journal_Flush(void)
+{
+    uint32_t intr_status;
+
+    if (0u == journal_stage.hdr.count)
+    {
+        return true;
+    }
+
+    intr_status = Cy_SysLib_EnterCriticalSection();
+    journal_program_buf = journal_stage;
+    (void)memset(&journal_stage, 0, sizeof(journal_stage));
+    Cy_SysLib_ExitCriticalSection(intr_status);
+
+    Fault_Journal_Seal(&journal_program_buf, journal_next_seq, journal_boot);
+
+    if (CY_FLASH_DRV_SUCCESS != Cy_Flash_WriteRow(FAULT_JOURNAL_BASE + (journal_next_row * FAULT_JOURNAL_ROW_SIZE),
+                                                  (const uint32_t *)&journal_program_buf))
+    {
+        /* The records of this row are dropped and counted. The next flush
+         * programs newly staged records into the same row again. */
+        journal_dropped += journal_program_buf.hdr.count;
+        return false;
+    }
+
+    journal_head_row = journal_next_row;
+    journal_next_row = (journal_next_row + 1u) % FAULT_JOURNAL_ROW_COUNT;
+    journal_next_seq++;
+
+    return true;
+}
+
+/*****************************************************************************
+ * Function Name: Fault_Journal_GetBoot
+ ******************************************************************************
+ * Summary:
+ * Returns the boot number, one more than the boot number of the newest row
+ * found in flash at start-up. Every boot that reached Fault_Journal_Init()
+ * has its own number.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint16_t : Boot number
+ *****************************************************************************/
+uint16_t Fault_Journal_GetBoot(void)
+{
+    return journal_boot;
+}
+
+/*****************************************************************************
+ * Function Name: Fault_Journal_GetDropped
+ ******************************************************************************
+ * Summary:
+ * Returns the number of records lost because the staging row was full or
+ * the row could not be programmed.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint32_t : Number of dropped records
+ *****************************************************************************/
+uint32_t Fault_Journal_GetDropped(void)
+{
+    return journal_dropped;
+}
+
+/*****************************************************************************
+ * Function Name: Fault_Journal_GetRow
+ ******************************************************************************
+ * Summary:
+ * Returns a programmed journal row, newest first.
+ *
+ * Parameters:
+ *  age : 0 for the newest row, 1 for the one before, and so on
+ *
+ * Return:
+ *  const fault_journal_row_t * : Pointer to the row in flash, or NULL if the
+ *  row does not exist or is not valid
+ *****************************************************************************/
+const fault_journal_row_t * Fault_Journal_GetRow(uint32_t age)
+{
+    return Fault_Journal_RowAt(FAULT_JOURNAL_ROW(0u), journal_head_row, age);
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,137 @@
+/******************************************************************************
+ * File Name:   fault_journal.h
+ *
+ * Description: This file is the public interface of fault_journal.c source file.
+ * The journal stores compact test result records in a reserved flash
+ * region so that they survive a reset.
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+/*******************************************************************************
+ * Include guard
+ *******************************************************************************/
+#ifndef FAULT_JOURNAL_H_
+#define FAULT_JOURNAL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+/* Journal flash region. Must match the fault journal region reserved in the
+ * linker scripts (templates/<TARGET>/TOOLCHAIN_<TOOLCHAIN>/). */
+#define FAULT_JOURNAL_BASE              (0x1201DE00UL)
+#define FAULT_JOURNAL_SIZE              (0x00002000UL)
+
+/* Flash row size, the unit in which the journal is programmed */
+#define FAULT_JOURNAL_ROW_SIZE          (512UL)
+/* The last two rows of the region hold the ILO trim record (ilo_trim.h) and
+ * the start-up register snapshot record (cfg_snapshot_cfg.h) */
+#define FAULT_JOURNAL_ROW_COUNT         ((FAULT_JOURNAL_SIZE / FAULT_JOURNAL_ROW_SIZE) - 2UL)
+
+/* "FJRN" - marks a programmed journal row */
+#define FAULT_JOURNAL_ROW_MAGIC         (0x4E524A46UL)
+
+#define FAULT_JOURNAL_HDR_SIZE          (16UL)
+#define FAULT_JOURNAL_CRC_OFFSET        (8UL)
+#define FAULT_JOURNAL_RECORD_SIZE       (12UL)
+#define FAULT_JOURNAL_RECORDS_PER_ROW   ((FAULT_JOURNAL_ROW_SIZE - FAULT_JOURNAL_HDR_SIZE) / FAULT_JOURNAL_RECORD_SIZE)
+
+/* Row index returned when the journal holds no valid row */
+#define FAULT_JOURNAL_NO_ROW            (0xFFFFFFFFUL)
+
+/*******************************************************************************
+ * Data Types
+ *******************************************************************************/
+/* One journal record. Layout is little-endian and packed by construction. */
+typedef struct
+{
+    uint32_t timestamp;     /* CPU cycles since boot (DWT CYCCNT) */
+    uint32_t detail;        /* Checksum, address or other test specific data */
+    uint8_t  test_id;       /* Index of the test (ip_index) */
+    uint8_t  status;        /* Self test return status */
+    uint16_t reserved;
+} fault_journal_record_t;
+
+/* Header at the start of every programmed journal row */
+typedef struct
+{
+    uint32_t magic;         /* FAULT_JOURNAL_ROW_MAGIC */
+    uint32_t crc;           /* CRC-32 of the row after this field */
+    uint32_t seq;           /* Row sequence number, +1 for every programmed row */
+    uint16_t boot;          /* Boot number the records were logged in */
+    uint16_t count;         /* Number of valid records in the row */
+} fault_journal_hdr_t;
+
+/* One journal row as it is stored in flash */
+typedef struct
+{
+    fault_journal_hdr_t    hdr;
+    fault_journal_record_t records[FAULT_JOURNAL_RECORDS_PER_ROW];
+    uint8_t                pad[FAULT_JOURNAL_ROW_SIZE - FAULT_JOURNAL_HDR_SIZE -
+                               (FAULT_JOURNAL_RECORDS_PER_ROW * FAULT_JOURNAL_RECORD_SIZE)];
+} fault_journal_row_t;
+
+/* Compile-time checks of the flash layout */
+typedef char fault_journal_record_size_check[(sizeof(fault_journal_record_t) == FAULT_JOURNAL_RECORD_SIZE) ? 1 : -1];
+typedef char fault_journal_hdr_size_check[(sizeof(fault_journal_hdr_t) == FAULT_JOURNAL_HDR_SIZE) ? 1 : -1];
+typedef char fault_journal_row_size_check[(sizeof(fault_journal_row_t) == FAULT_JOURNAL_ROW_SIZE) ? 1 : -1];
+
+/*******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+void Fault_Journal_Init(void);
+void Fault_Journal_Log(uint8_t test_id, uint8_t status, uint32_t detail);
+bool Fault_Journal_Flush(void);
+uint16_t Fault_Journal_GetBoot(void);
+uint32_t Fault_Journal_GetDropped(void);
+const fault_journal_row_t * Fault_Journal_GetRow(uint32_t age);
+
+/* Row format, fault_journal_row.c */
+uint32_t Fault_Journal_Crc32(const uint8_t *data, uint32_t length);
+void Fault_Journal_Seal(fault_journal_row_t *row, uint32_t seq, uint16_t boot);
+bool Fault_Journal_RowIsValid(const fault_journal_row_t *row);
+uint32_t Fault_Journal_FindHead(const fault_journal_row_t *rows);
+const fault_journal_row_t * Fault_Journal_RowAt(const fault_journal_row_t *rows, uint32_t head, uint32_t age);
+
+#endif /* FAULT_JOURNAL_H_ */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,223 @@
+/******************************************************************************
+ * File Name:   fault_journal_row.c
+ *
+ * Description: This file implements the fault journal row format: CRC,
+ * validation, sealing and the search for the newest row. It does not
+ * access the flash, so it also builds on a host (tools/fault_journal_fuzz.c).
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+#include <stddef.h>
+#include "fault_journal.h"
+
+/*******************************************************************************
+ * Global Variables
+ *******************************************************************************/
+/* CRC-32 (IEEE 802.3, reflected) lookup table, one nibble at a time */
+static const uint32_t crc32_nibble_table[16] =
+{
+    0x00000000UL, 0x1DB71064UL, 0x3B6E20C8UL, 0x26D930ACUL,
+    0x76DC4190UL, 0x6B6B51F4UL, 0x4DB26158UL, 0x5005713CUL,
+    0xEDB88320UL, 0xF00F9344UL, 0xD6D6A3E8UL, 0xCB61B38CUL,
+    0x9B64C2B0UL, 0x86D3D2D4UL, 0xA00AE278UL, 0xBDBDF21CUL
+};
+
+/*******************************************************************************
+ * Function Definitions
+ *******************************************************************************/
+
+/*****************************************************************************
+ * Function Name: Fault_Journal_Crc32
+ ******************************************************************************
+ * Summary:
+ * Calculates the CRC-32 (same as zlib crc32()) of a buffer. Also used for
+ * the ILO trim record.
+ *
+ * Parameters:
+ *  data   : Pointer to the data
+ *  length : Number of bytes
+ *
+ * Return:
+ *  uint32_t : CRC-32 of the data
+ *****************************************************************************/
+uint32_t Fault_Journal_Crc32(const uint8_t *data, uint32_t length)
+{
+    uint32_t crc = 0xFFFFFFFFUL;
+
+    for (uint32_t i = 0u; i < length; i++)
+    {
+        crc ^= data[i];
+        crc = (crc >> 4u) ^ crc32_nibble_table[crc & 0x0Fu];
+        crc = (crc >> 4u) ^ crc32_nibble_table[crc & 0x0Fu];
+    }
+
+    return ~crc;
+}
+
+/*****************************************************************************
+ * Function Name: Fault_Journal_Seal
+ ******************************************************************************
+ * Summary:
+ * Completes the header of a staged row: magic, sequence and boot number,
+ * and the CRC over the row after the CRC field.
+ *
+ * Parameters:
+ *  row  : Row with the records and the record count filled in
+ *  seq  : Row sequence number
+ *  boot : Boot number
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+void Fault_Journal_Seal(fault_journal_row_t *row, uint32_t seq, uint16_t boot)
+{
+    row->hdr.magic = FAULT_JOURNAL_ROW_MAGIC;
+    row->hdr.seq = seq;
+    row->hdr.boot = boot;
+    row->hdr.crc = Fault_Journal_Crc32((const uint8_t *)row + FAULT_JOURNAL_CRC_OFFSET,
+                                       FAULT_JOURNAL_ROW_SIZE - FAULT_JOURNAL_CRC_OFFSET);
+}
+
+/*****************************************************************************
+ * Function Name: Fault_Journal_RowIsValid
+ ******************************************************************************
+ * Summary:
+ * Checks the magic number, record count and CRC of a journal row. Erased,
+ * torn (interrupted programming) and corrupted rows are all reported invalid.
+ *
+ * Parameters:
+ *  row : Pointer to the row
+ *
+ * Return:
+ *  bool : true if the row holds a complete set of records
+ *****************************************************************************/
+bool Fault_Journal_RowIsValid(const fault_journal_row_t *row)
+{
+    return ((FAULT_JOURNAL_ROW_MAGIC == row->hdr.magic) &&
+            (row->hdr.count <= FAULT_JOURNAL_RECORDS_PER_ROW) &&
+            (row->hdr.crc == Fault_Journal_Crc32((const uint8_t *)row + FAULT_JOURNAL_CRC_OFFSET,
+                                                 FAULT_JOURNAL_ROW_SIZE - FAULT_JOURNAL_CRC_OFFSET)));
+}
+
+/*****************************************************************************
+ * Function Name: Fault_Journal_FindHead
+ ******************************************************************************
+ * Summary:
+ * Finds the most recently programmed row. Rows are programmed in ring order
+ * with a sequence number that grows by one per row, so the rows of the
+ * current lap are exactly those with seq == seq(row 0) + index. They form a
+ * prefix of the region, which is located by binary search in
+ * log2(FAULT_JOURNAL_ROW_COUNT) row checks.
+ *
+ * Parameters:
+ *  rows : First of the FAULT_JOURNAL_ROW_COUNT journal rows
+ *
+ * Return:
+ *  uint32_t : Index of the head row, or FAULT_JOURNAL_NO_ROW
+ *****************************************************************************/
+uint32_t Fault_Journal_FindHead(const fault_journal_row_t *rows)
+{
+    const fault_journal_row_t *first = &rows[0];
+    uint32_t lo = 0u;
+    uint32_t hi = FAULT_JOURNAL_ROW_COUNT;
+
+    if (!Fault_Journal_RowIsValid(first))
+    {
+        /* Either the journal is empty, or programming of row 0 was interrupted
+         * while wrapping around, in which case the last row is the head */
+        return Fault_Journal_RowIsValid(&rows[FAULT_JOURNAL_ROW_COUNT - 1u]) ?
+               (FAULT_JOURNAL_ROW_COUNT - 1u) : FAULT_JOURNAL_NO_ROW;
+    }
+
+    /* Invariant: row lo is in the current lap, row hi is not */
+    while ((hi - lo) > 1u)
+    {
+        const uint32_t mid = lo + ((hi - lo) / 2u);
+        const fault_journal_row_t *row = &rows[mid];
+
+        if (Fault_Journal_RowIsValid(row) && (row->hdr.seq == (first->hdr.seq + mid)))
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+/*****************************************************************************
+ * Function Name: Fault_Journal_RowAt
+ ******************************************************************************
+ * Summary:
+ * Returns a row of the journal by its age relative to the head row. Rows
+ * that are not valid or do not continue the sequence of the head row (left
+ * over from an older lap) are not returned.
+ *
+ * Parameters:
+ *  rows : First of the FAULT_JOURNAL_ROW_COUNT journal rows
+ *  head : Index of the head row, see Fault_Journal_FindHead()
+ *  age  : 0 for the head row, 1 for the one before, and so on
+ *
+ * Return:
+ *  const fault_journal_row_t * : Pointer to the row, or NULL
+ *****************************************************************************/
+const fault_journal_row_t * Fault_Journal_RowAt(const fault_journal_row_t *rows, uint32_t head, uint32_t age)
+{
+    const fault_journal_row_t *row;
+
+    if ((head >= FAULT_JOURNAL_ROW_COUNT) || (age >= FAULT_JOURNAL_ROW_COUNT))
+    {
+        return NULL;
+    }
+
+    row = &rows[(head + FAULT_JOURNAL_ROW_COUNT - age) % FAULT_JOURNAL_ROW_COUNT];
+
+    if (!Fault_Journal_RowIsValid(row) || (row->hdr.seq != (rows[head].hdr.seq - age)))
+    {
+        return NULL;
+    }
+
+    return row;
+}
+
+
+/* [] END OF FILE */
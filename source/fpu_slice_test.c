@@ -0,0 +1,333 @@
+/******************************************************************************
+ * File Name:   fpu_slice_test.c
+ *
+ * Description: This file provides the FPU register test that runs in slices
+ * while the application uses the FPU.
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+#include "cy_pdl.h"
+#include "SelfTest.h"
+#include "fpu_slice_test.h"
+#include "cycle_counter.h"
+
+#if !defined (__FPU_USED) || (__FPU_USED == 0U)
+#error "fpu_slice_test.c needs the FPU (VFP_SELECT=softfp or hardfp)"
+#endif
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+/* CP10 and CP11 full access */
+#define FPU_SLICE_CPACR_FULL    ((3UL << 20u) | (3UL << 22u))
+
+/* Reads back one register and accumulates the bits that differ from the
+ * pattern operand in the err operand */
+#define FPU_SLICE_CHECK(reg, pattern) \
+    "vmov   %[tmp], " reg "\n\t" \
+    "eor    %[tmp], %[tmp], %[" pattern "]\n\t" \
+    "orr    %[err], %[err], %[tmp]\n\t"
+
+/* Checkerboard test of eight S-registers. The registers are saved to the
+ * buffer saved, written with both phases of the checkerboard, read back and
+ * restored, all in one asm block, so the compiler never sees the test
+ * values. The bits that read back wrong are ORed into result.
+ *
+ * The S-registers are not in the clobber list on purpose: the block restores
+ * every register it writes before it ends, so they hold the compiler's
+ * values again, and all operands are core registers. Clobbering them would
+ * only make the compiler save S16-S31 a second time, inside the
+ * interrupt-off window. The "memory" clobber covers the save buffer. */
+#define FPU_SLICE_BANK(result, scratch, saved, r0, r1, r2, r3, r4, r5, r6, r7) \
+    __ASM volatile ( \
+        "vstmia %[buf], {" r0 "-" r7 "}\n\t" \
+        "vmov   " r0 ", %[pa]\n\t" \
+        "vmov   " r1 ", %[pb]\n\t" \
+        "vmov   " r2 ", %[pa]\n\t" \
+        "vmov   " r3 ", %[pb]\n\t" \
+        "vmov   " r4 ", %[pa]\n\t" \
+        "vmov   " r5 ", %[pb]\n\t" \
+        "vmov   " r6 ", %[pa]\n\t" \
+        "vmov   " r7 ", %[pb]\n\t" \
+        FPU_SLICE_CHECK(r0, "pa") FPU_SLICE_CHECK(r1, "pb") \
+        FPU_SLICE_CHECK(r2, "pa") FPU_SLICE_CHECK(r3, "pb") \
+        FPU_SLICE_CHECK(r4, "pa") FPU_SLICE_CHECK(r5, "pb") \
+        FPU_SLICE_CHECK(r6, "pa") FPU_SLICE_CHECK(r7, "pb") \
+        "vmov   " r0 ", %[pb]\n\t" \
+        "vmov   " r1 ", %[pa]\n\t" \
+        "vmov   " r2 ", %[pb]\n\t" \
+        "vmov   " r3 ", %[pa]\n\t" \
+        "vmov   " r4 ", %[pb]\n\t" \
+        "vmov   " r5 ", %[pa]\n\t" \
+        "vmov   " r6 ", %[pb]\n\t" \
+        "vmov   " r7 ", %[pa]\n\t" \
+        FPU_SLICE_CHECK(r0, "pb") FPU_SLICE_CHECK(r1, "pa") \
+        FPU_SLICE_CHECK(r2, "pb") FPU_SLICE_CHECK(r3, "pa") \
+        FPU_SLICE_CHECK(r4, "pb") FPU_SLICE_CHECK(r5, "pa") \
+        FPU_SLICE_CHECK(r6, "pb") FPU_SLICE_CHECK(r7, "pa") \
+        "vldmia %[buf], {" r0 "-" r7 "}\n\t" \
+        : [err] "+r" (result), [tmp] "=&r" (scratch) \
+        : [buf] "r" (saved), [pa] "r" (FPU_SLICE_PATTERN_A), [pb] "r" (FPU_SLICE_PATTERN_B) \
+        : "memory")
+
+/*******************************************************************************
+ * Global Variables
+ *******************************************************************************/
+static uint32_t fpu_slice_next = 0u;
+static uint32_t fpu_slice_detail = 0u;
+static fpu_slice_stats_t fpu_slice_stats;
+
+/*******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+static uint32_t Fpu_Slice_Bank(uint32_t bank);
+static uint32_t Fpu_Slice_Fpscr(void);
+
+/*******************************************************************************
+ * Function Definitions
+ *******************************************************************************/
+
+/*****************************************************************************
+ * Function Name: Fpu_Slice_Bank
+ ******************************************************************************
+ * Summary:
+ * Tests one bank of eight S-registers with a checkerboard and restores it.
+ * Must be called with interrupts disabled.
+ *
+ * Parameters:
+ *  bank : Bank index, 0 (S0-S7) to FPU_SLICE_BANK_COUNT - 1 (S24-S31)
+ *
+ * Return:
+ *  uint32_t : Bits that did not read back as written, 0 when the bank passed
+ *****************************************************************************/
+static uint32_t Fpu_Slice_Bank(uint32_t bank)
+{
+    uint32_t save[8];
+    uint32_t err = 0u;
+    uint32_t tmp;
+
+    switch (bank)
+    {
+        case 0u:
+            FPU_SLICE_BANK(err, tmp, save, "s0", "s1", "s2", "s3", "s4", "s5", "s6", "s7");
+            break;
+        case 1u:
+            FPU_SLICE_BANK(err, tmp, save, "s8", "s9", "s10", "s11", "s12", "s13", "s14", "s15");
+            break;
+        case 2u:
+            FPU_SLICE_BANK(err, tmp, save, "s16", "s17", "s18", "s19", "s20", "s21", "s22", "s23");
+            break;
+        default:
+            FPU_SLICE_BANK(err, tmp, save, "s24", "s25", "s26", "s27", "s28", "s29", "s30", "s31");
+            break;
+    }
+
+    return err;
+}
+
+/*****************************************************************************
+ * Function Name: Fpu_Slice_Fpscr
+ ******************************************************************************
+ * Summary:
+ * Tests the writable FPSCR bits with a checkerboard and restores the FPSCR.
+ * Must be called with interrupts disabled.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint32_t : Bits that did not read back as written, 0 when the FPSCR passed
+ *****************************************************************************/
+static uint32_t Fpu_Slice_Fpscr(void)
+{
+    const uint32_t save = __get_FPSCR();
+    uint32_t err;
+
+    __set_FPSCR(FPU_SLICE_PATTERN_A & FPU_SLICE_FPSCR_MASK);
+    err = (__get_FPSCR() ^ FPU_SLICE_PATTERN_A) & FPU_SLICE_FPSCR_MASK;
+    __set_FPSCR(FPU_SLICE_PATTERN_B & FPU_SLICE_FPSCR_MASK);
+    err |= (__get_FPSCR() ^ FPU_SLICE_PATTERN_B) & FPU_SLICE_FPSCR_MASK;
+    __set_FPSCR(save);
+
+    return err;
+}
+
+/*****************************************************************************
+ * Function Name: Fpu_Slice_Test
+ ******************************************************************************
+ * Summary:
+ * Tests the next bank of FPU registers. Only the registers under test are
+ * saved and restored, with interrupts disabled, so the test can run at any
+ * time while the application or interrupt handlers use the FPU.
+ *
+ * The test leaves lazy FP state preservation (FPCCR.LSPEN) as configured. A
+ * lazy save that is pending when the slice starts is triggered by the first
+ * FP instruction, which runs before interrupts are disabled, so it does not
+ * extend the interrupt-off window. When the caller had no active FP context
+ * (CONTROL.FPCA clear), it is cleared again afterwards, so later interrupts
+ * keep using the basic stack frame.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint8_t : PASS_STILL_TESTING_STATUS until the last slice of a run,
+ *            PASS_COMPLETE_STATUS after it, ERROR_STATUS on a fault
+ *****************************************************************************/
+uint8_t Fpu_Slice_Test(void)
+{
+    const uint32_t start = Cycle_Counter_Get();
+    const uint32_t control = __get_CONTROL();
+    const uint32_t slice = fpu_slice_next;
+    uint32_t intr_status;
+    uint32_t irq_off;
+    uint32_t cycles;
+    uint32_t err;
+
+    /* An FP instruction with CP10/CP11 disabled raises a UsageFault */
+    if (FPU_SLICE_CPACR_FULL != (SCB->CPACR & FPU_SLICE_CPACR_FULL))
+    {
+        fpu_slice_detail = (slice << 24u) | 0x00FFFFFFUL;
+        return ERROR_STATUS;
+    }
+
+    if (0u != (FPU->FPCCR & FPU_FPCCR_LSPACT_Msk))
+    {
+        fpu_slice_stats.lazy_pending++;
+    }
+    /* Trigger a pending lazy save here, with interrupts enabled */
+    (void)__get_FPSCR();
+
+    intr_status = Cy_SysLib_EnterCriticalSection();
+    irq_off = Cycle_Counter_Get();
+    err = (slice < FPU_SLICE_BANK_COUNT) ? Fpu_Slice_Bank(slice) : Fpu_Slice_Fpscr();
+    if (0u == (control & CONTROL_FPCA_Msk))
+    {
+        __set_CONTROL(__get_CONTROL() & ~CONTROL_FPCA_Msk);
+        __ISB();
+    }
+    irq_off = Cycle_Counter_Get() - irq_off;
+    Cy_SysLib_ExitCriticalSection(intr_status);
+
+    cycles = Cycle_Counter_Get() - start;
+    fpu_slice_stats.slices++;
+    if (cycles > fpu_slice_stats.max_cycles)
+    {
+        fpu_slice_stats.max_cycles = cycles;
+    }
+    if (irq_off > fpu_slice_stats.max_irq_off)
+    {
+        fpu_slice_stats.max_irq_off = irq_off;
+    }
+
+    if (0u != err)
+    {
+        /* Failing slice and the OR of the failing bits, folded to 24 bits */
+        fpu_slice_detail = (slice << 24u) | ((err | (err >> 24u)) & 0x00FFFFFFUL);
+        fpu_slice_stats.failures++;
+        fpu_slice_next = 0u;
+        return ERROR_STATUS;
+    }
+
+    fpu_slice_next++;
+    if (fpu_slice_next < FPU_SLICE_COUNT)
+    {
+        return PASS_STILL_TESTING_STATUS;
+    }
+
+    fpu_slice_next = 0u;
+    fpu_slice_stats.runs++;
+    return PASS_COMPLETE_STATUS;
+}
+
+/*****************************************************************************
+ * Function Name: Fpu_Slice_Restart
+ ******************************************************************************
+ * Summary:
+ * Starts the next run with the first register bank.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+void Fpu_Slice_Restart(void)
+{
+    fpu_slice_next = 0u;
+}
+
+/*****************************************************************************
+ * Function Name: Fpu_Slice_GetDetail
+ ******************************************************************************
+ * Summary:
+ * Returns the detail of the last failure: the slice in bits 24 to 31 and the
+ * failing register bits in bits 0 to 23 (bits 24 to 31 folded onto bits 0
+ * to 7). All register bits are set when the FPU is not enabled.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint32_t : Failure detail
+ *****************************************************************************/
+uint32_t Fpu_Slice_GetDetail(void)
+{
+    return fpu_slice_detail;
+}
+
+/*****************************************************************************
+ * Function Name: Fpu_Slice_GetStats
+ ******************************************************************************
+ * Summary:
+ * Returns the slice counts and the worst-case slice and interrupt-off cycles.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  const fpu_slice_stats_t * : Statistics
+ *****************************************************************************/
+const fpu_slice_stats_t * Fpu_Slice_GetStats(void)
+{
+    return &fpu_slice_stats;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,93 @@
+/******************************************************************************
+ * File Name:   fpu_slice_test.h
+ *
+ * Description: This file provides the FPU register test that runs in slices
+ * while the application uses the FPU.
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+/*******************************************************************************
+ * Include guard
+ *******************************************************************************/
+#ifndef FPU_SLICE_TEST_H_
+#define FPU_SLICE_TEST_H_
+
+#include <stdint.h>
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+/* Slices of one complete run: S0-S7, S8-S15, S16-S23, S24-S31 and FPSCR */
+#define FPU_SLICE_BANK_COUNT            (4u)
+#define FPU_SLICE_COUNT                 (FPU_SLICE_BANK_COUNT + 1u)
+
+/* Checkerboard patterns, written alternately to neighbouring registers */
+#define FPU_SLICE_PATTERN_A             (0x55555555UL)
+#define FPU_SLICE_PATTERN_B             (0xAAAAAAAAUL)
+
+/* FPSCR bits that can be written: N, Z, C, V, AHP, DN, FZ, RMode and the
+ * cumulative exception flags */
+#define FPU_SLICE_FPSCR_MASK            (0xF7C0009FUL)
+
+/*******************************************************************************
+ * Data Types
+ *******************************************************************************/
+/* Cost of the slices, accumulated since start-up */
+typedef struct
+{
+    uint32_t slices;            /* Slices run */
+    uint32_t runs;              /* Complete runs */
+    uint32_t failures;          /* Failed slices */
+    uint32_t lazy_pending;      /* Slices started with a lazy FP state save pending */
+    uint32_t max_cycles;        /* Longest slice, in CPU cycles */
+    uint32_t max_irq_off;       /* Longest interrupt-off window, in CPU cycles */
+} fpu_slice_stats_t;
+
+/*******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+uint8_t Fpu_Slice_Test(void);
+void Fpu_Slice_Restart(void);
+uint32_t Fpu_Slice_GetDetail(void);
+const fpu_slice_stats_t * Fpu_Slice_GetStats(void);
+
+#endif /* FPU_SLICE_TEST_H_ */
+
+
+/* [] END OF FILE */
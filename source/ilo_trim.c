@@ -0,0 +1,428 @@
+/******************************************************************************
+ * File Name:   ilo_trim.c
+ *
+ * Description: This file provides the ILO trim manager. The ILO is measured
+ * against the IMO and trimmed step by step until the trim converges. The
+ * converged trim is kept in retained RAM and in a flash record, together
+ * with the temperature/voltage it was converged at, and reapplied on later
+ * boots without a measurement. Later measurements run in the background.
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+#include <string.h>
+#include "cy_pdl.h"
+#include "ilo_trim.h"
+#include "fault_journal.h"
+#include "test_low_power.h"
+#include "clock_monitor.h"
+#include "clock_monitor_cfg.h"
+#include "cycle_counter.h"
+
+/*******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+static uint32_t Ilo_Trim_Crc(const ilo_trim_record_t *record);
+static bool Ilo_Trim_IsValid(const ilo_trim_record_t *record);
+static bool Ilo_Trim_TagMatches(const ilo_trim_tag_t *a, const ilo_trim_tag_t *b);
+static void Ilo_Trim_Store(uint32_t freq, const ilo_trim_tag_t *tag);
+
+/*******************************************************************************
+ * Global Variables
+ *******************************************************************************/
+/* Survives a warm reset, checked by its CRC */
+CY_NOINIT static ilo_trim_record_t ilo_trim_retained;
+
+static ilo_trim_record_t ilo_trim_current;
+
+/* Program buffer of the flash record row */
+static uint32_t ilo_trim_row[FAULT_JOURNAL_ROW_SIZE / sizeof(uint32_t)];
+
+static volatile bool ilo_trim_recal = false;
+static bool ilo_trim_measuring = false;
+static uint32_t ilo_trim_steps = 0u;
+static uint32_t ilo_trim_started = 0u;
+static uint32_t ilo_trim_polls = 0u;
+
+/*******************************************************************************
+ * Function Definitions
+ *******************************************************************************/
+
+/*****************************************************************************
+ * Function Name: Ilo_Trim_Crc
+ ******************************************************************************
+ * Summary:
+ * Calculates the CRC-32 of a trim record after the crc field.
+ *
+ * Parameters:
+ *  record : Pointer to the record
+ *
+ * Return:
+ *  uint32_t : CRC-32
+ *****************************************************************************/
+static uint32_t Ilo_Trim_Crc(const ilo_trim_record_t *record)
+{
+    return Fault_Journal_Crc32((const uint8_t *)record + ILO_TRIM_CRC_OFFSET,
+                               (uint32_t)sizeof(ilo_trim_record_t) - ILO_TRIM_CRC_OFFSET);
+}
+
+/*****************************************************************************
+ * Function Name: Ilo_Trim_IsValid
+ ******************************************************************************
+ * Summary:
+ * Checks the magic number and CRC of a trim record.
+ *
+ * Parameters:
+ *  record : Pointer to the record
+ *
+ * Return:
+ *  bool : true if the record is valid
+ *****************************************************************************/
+static bool Ilo_Trim_IsValid(const ilo_trim_record_t *record)
+{
+    return (ILO_TRIM_RECORD_MAGIC == record->magic) && (record->crc == Ilo_Trim_Crc(record));
+}
+
+/*****************************************************************************
+ * Function Name: Ilo_Trim_TagMatches
+ ******************************************************************************
+ * Summary:
+ * Checks whether two temperature/voltage tags are within the reuse limits.
+ * Tags without information always match.
+ *
+ * Parameters:
+ *  a : First tag
+ *  b : Second tag
+ *
+ * Return:
+ *  bool : true if a trim converged at one tag can be used at the other
+ *****************************************************************************/
+static bool Ilo_Trim_TagMatches(const ilo_trim_tag_t *a, const ilo_trim_tag_t *b)
+{
+    const int32_t temp_diff = (int32_t)a->temp_c - (int32_t)b->temp_c;
+    const int32_t vdd_diff = (int32_t)a->vdd_mv - (int32_t)b->vdd_mv;
+
+    if ((ILO_TRIM_TAG_UNKNOWN == a->vdd_mv) || (ILO_TRIM_TAG_UNKNOWN == b->vdd_mv))
+    {
+        return true;
+    }
+
+    return (temp_diff <= ILO_TRIM_TEMP_DELTA_C) && (temp_diff >= -ILO_TRIM_TEMP_DELTA_C) &&
+           (vdd_diff <= (int32_t)ILO_TRIM_VDD_DELTA_MV) && (vdd_diff >= -(int32_t)ILO_TRIM_VDD_DELTA_MV);
+}
+
+/*****************************************************************************
+ * Function Name: Ilo_Trim_Store
+ ******************************************************************************
+ * Summary:
+ * Stores the current (converged) trim in retained RAM. The flash record is
+ * only programmed when the trim or the tag differs from the stored one.
+ *
+ * Parameters:
+ *  freq : ILO frequency measured with the current trim
+ *  tag  : Operating conditions of the measurement
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+static void Ilo_Trim_Store(uint32_t freq, const ilo_trim_tag_t *tag)
+{
+    const ilo_trim_record_t *flash_record = (const ilo_trim_record_t *)ILO_TRIM_RECORD_ADDR;
+    const bool flash_valid = Ilo_Trim_IsValid(flash_record);
+
+    ilo_trim_current.magic = ILO_TRIM_RECORD_MAGIC;
+    ilo_trim_current.trim = Cy_SysClk_IloGetTrim();
+    ilo_trim_current.freq = freq;
+    ilo_trim_current.tag = *tag;
+    ilo_trim_current.writes = flash_valid ? flash_record->writes : 0u;
+
+    if (!flash_valid || (flash_record->trim != ilo_trim_current.trim) ||
+        !Ilo_Trim_TagMatches(&flash_record->tag, tag))
+    {
+        ilo_trim_current.writes++;
+        ilo_trim_current.crc = Ilo_Trim_Crc(&ilo_trim_current);
+
+        (void)memset(ilo_trim_row, 0, sizeof(ilo_trim_row));
+        (void)memcpy(ilo_trim_row, &ilo_trim_current, sizeof(ilo_trim_current));
+        if (CY_FLASH_DRV_SUCCESS != Cy_Flash_WriteRow(ILO_TRIM_RECORD_ADDR, ilo_trim_row))
+        {
+            /* Kept in retained RAM only, written again after the next convergence */
+            ilo_trim_current.writes--;
+        }
+    }
+
+    ilo_trim_current.crc = Ilo_Trim_Crc(&ilo_trim_current);
+    ilo_trim_retained = ilo_trim_current;
+}
+
+/*****************************************************************************
+ * Function Name: Ilo_Trim_Init
+ ******************************************************************************
+ * Summary:
+ * Applies the stored ILO trim if it is valid and was converged at similar
+ * operating conditions: the retained RAM copy after a warm reset, else the
+ * flash record. Only if neither can be used, the ILO is measured and trimmed
+ * until the trim converges, which waits for the measurements (each at most
+ * CLOCK_MONITOR_TIMEOUT_CYCLES). Call before the clock test.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  ilo_trim_source_t : Where the applied trim came from
+ *****************************************************************************/
+ilo_trim_source_t Ilo_Trim_Init(void)
+{
+    const ilo_trim_record_t *flash_record = (const ilo_trim_record_t *)ILO_TRIM_RECORD_ADDR;
+    ilo_trim_tag_t tag;
+    uint32_t freq;
+
+    Ilo_Trim_GetTag(&tag);
+
+    if (Ilo_Trim_IsValid(&ilo_trim_retained) && Ilo_Trim_TagMatches(&ilo_trim_retained.tag, &tag))
+    {
+        ilo_trim_current = ilo_trim_retained;
+        Cy_SysClk_IloSetTrim(ilo_trim_current.trim);
+        return ILO_TRIM_FROM_RETAINED;
+    }
+
+    if (Ilo_Trim_IsValid(flash_record) && Ilo_Trim_TagMatches(&flash_record->tag, &tag))
+    {
+        ilo_trim_current = *flash_record;
+        ilo_trim_retained = ilo_trim_current;
+        Cy_SysClk_IloSetTrim(ilo_trim_current.trim);
+        return ILO_TRIM_FROM_FLASH;
+    }
+
+    for (uint32_t step = 0u; step < ILO_TRIM_MAX_STEPS; step++)
+    {
+        /* Start the ILO clock measurement using the IMO- counter 1 clock - ILO counter 2 clock - IMO */
+        if (CY_SYSCLK_SUCCESS != Cy_SysClk_StartClkMeasurementCounters(CY_SYSCLK_MEAS_CLK_ILO, ILO_TRIM_MEAS_COUNT,
+                                                                       CY_SYSCLK_MEAS_CLK_IMO))
+        {
+            break;
+        }
+        /* Wait for counter 1 to reach 0, a stopped ILO never gets there */
+        ilo_trim_started = Cycle_Counter_Get();
+        while (!Cy_SysClk_ClkMeasurementCountersDone())
+        {
+            if ((Cycle_Counter_Get() - ilo_trim_started) >= CLOCK_MONITOR_TIMEOUT_CYCLES)
+            {
+                return ILO_TRIM_NOT_CONVERGED;
+            }
+        }
+        freq = Cy_SysClk_ClkMeasurementCountersGetFreq(false, ILO_TRIM_IMO_FREQ);
+
+        /* No change: the ILO is within the trim tolerance */
+        if (0 == Cy_SysClk_IloTrim(freq))
+        {
+            Ilo_Trim_Store(freq, &tag);
+            return ILO_TRIM_FROM_MEASUREMENT;
+        }
+    }
+
+    return ILO_TRIM_NOT_CONVERGED;
+}
+
+/*****************************************************************************
+ * Function Name: Ilo_Trim_Poll
+ ******************************************************************************
+ * Summary:
+ * Runs the background re-measurement, one trim step per completed
+ * measurement. A re-measurement starts after Ilo_Trim_RequestRecal() or
+ * when the operating conditions moved out of the limits of the stored tag.
+ * Never waits for a measurement. Deep Sleep is refused while a measurement
+ * runs. A measurement that does not complete within the clock monitor
+ * timeouts (a stopped ILO) is given up, so it does not hold the counters
+ * from the clock monitor, which reports the ILO. Call from the idle loop.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+void Ilo_Trim_Poll(void)
+{
+    ilo_trim_tag_t tag;
+
+    if (!ilo_trim_measuring)
+    {
+        Ilo_Trim_GetTag(&tag);
+        if (!ilo_trim_recal && Ilo_Trim_TagMatches(&ilo_trim_current.tag, &tag))
+        {
+            return;
+        }
+
+        /* A start would restart the counters under the open measurement of
+         * the clock monitor, even when it completed and is not read yet */
+        if (Clock_Monitor_IsBusy())
+        {
+            return;
+        }
+
+        /* Measurement counters held for Deep Sleep entry, retry later */
+        if (CY_SYSCLK_SUCCESS == Cy_SysClk_StartClkMeasurementCounters(CY_SYSCLK_MEAS_CLK_ILO, ILO_TRIM_MEAS_COUNT,
+                                                                       CY_SYSCLK_MEAS_CLK_IMO))
+        {
+            ilo_trim_recal = false;
+            ilo_trim_measuring = true;
+            ilo_trim_started = Cycle_Counter_Get();
+            ilo_trim_polls = 0u;
+
+            /* The IMO and the counters stop in Deep Sleep */
+            Test_LowPower_WindowBegin();
+        }
+    }
+    else if (Cy_SysClk_ClkMeasurementCountersDone())
+    {
+        const uint32_t freq = Cy_SysClk_ClkMeasurementCountersGetFreq(false, ILO_TRIM_IMO_FREQ);
+
+        ilo_trim_measuring = false;
+        ilo_trim_steps++;
+        Test_LowPower_WindowEnd();
+
+        if (0 == Cy_SysClk_IloTrim(freq))
+        {
+            Ilo_Trim_GetTag(&tag);
+            Ilo_Trim_Store(freq, &tag);
+            ilo_trim_steps = 0u;
+        }
+        else if (ilo_trim_steps < ILO_TRIM_MAX_STEPS)
+        {
+            /* Next step on the next call */
+            ilo_trim_recal = true;
+        }
+        else
+        {
+            /* Not converging, keep the trim until the next request */
+            ilo_trim_steps = 0u;
+        }
+    }
+    else
+    {
+        /* Measurement running */
+        ilo_trim_polls++;
+        if (((Cycle_Counter_Get() - ilo_trim_started) >= CLOCK_MONITOR_TIMEOUT_CYCLES) ||
+            (ilo_trim_polls >= CLOCK_MONITOR_TIMEOUT_POLLS))
+        {
+            /* Keep the trim, the counters are programmed again by the next start */
+            ilo_trim_measuring = false;
+            ilo_trim_steps = 0u;
+            Test_LowPower_WindowEnd();
+        }
+    }
+}
+
+/*****************************************************************************
+ * Function Name: Ilo_Trim_RequestRecal
+ ******************************************************************************
+ * Summary:
+ * Requests a background re-measurement, for example, when the clock test
+ * detected ILO drift. Can be called from an interrupt.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+void Ilo_Trim_RequestRecal(void)
+{
+    ilo_trim_recal = true;
+}
+
+/*****************************************************************************
+ * Function Name: Ilo_Trim_IsBusy
+ ******************************************************************************
+ * Summary:
+ * Returns whether the trim manager uses the clock measurement counters.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  bool : true while a background measurement runs
+ *****************************************************************************/
+bool Ilo_Trim_IsBusy(void)
+{
+    return ilo_trim_measuring;
+}
+
+/*****************************************************************************
+ * Function Name: Ilo_Trim_GetRecord
+ ******************************************************************************
+ * Summary:
+ * Returns the trim record in use.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  const ilo_trim_record_t * : Trim record, magic is 0 if the trim never
+ *  converged
+ *****************************************************************************/
+const ilo_trim_record_t * Ilo_Trim_GetRecord(void)
+{
+    return &ilo_trim_current;
+}
+
+/*****************************************************************************
+ * Function Name: Ilo_Trim_GetTag
+ ******************************************************************************
+ * Summary:
+ * Returns the current operating conditions. Override this weak function to
+ * tag the trim with the die temperature and supply voltage, for example from
+ * the last ADC readings. It is called on every Ilo_Trim_Poll() and must not
+ * wait. The default returns a tag without information, so the stored trim is
+ * always reused.
+ *
+ * Parameters:
+ *  tag : Returns the operating conditions
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+__WEAK void Ilo_Trim_GetTag(ilo_trim_tag_t *tag)
+{
+    tag->temp_c = 0;
+    tag->vdd_mv = ILO_TRIM_TAG_UNKNOWN;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,122 @@
+/******************************************************************************
+ * File Name:   ilo_trim.h
+ *
+ * Description: This file provides the ILO trim manager. The trim is converged
+ * once, stored with a temperature/voltage tag, and reapplied on later
+ * boots.
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+/*******************************************************************************
+ * Include guard
+ *******************************************************************************/
+#ifndef ILO_TRIM_H_
+#define ILO_TRIM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "fault_journal.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+/* The trim record uses the last row of the fault journal region */
+#define ILO_TRIM_RECORD_ADDR            (FAULT_JOURNAL_BASE + FAULT_JOURNAL_SIZE - FAULT_JOURNAL_ROW_SIZE)
+
+/* "ILOT" - marks a valid trim record */
+#define ILO_TRIM_RECORD_MAGIC           (0x544F4C49UL)
+#define ILO_TRIM_CRC_OFFSET             (8UL)
+
+/* Reference clock of the ILO measurement */
+#define ILO_TRIM_IMO_FREQ               (8000000UL)
+/* Counter 1 period of one measurement, in ILO cycles */
+#define ILO_TRIM_MEAS_COUNT             (0x7FUL)
+/* Trim steps before the trim is given up as not converging */
+#define ILO_TRIM_MAX_STEPS              (32u)
+
+/* A stored trim is reused while the tag is within these limits */
+#define ILO_TRIM_TEMP_DELTA_C           (10)
+#define ILO_TRIM_VDD_DELTA_MV           (100u)
+/* vdd_mv value of a tag without temperature/voltage information */
+#define ILO_TRIM_TAG_UNKNOWN            (0u)
+
+/*******************************************************************************
+ * Data Types
+ *******************************************************************************/
+/* Operating conditions the trim was converged at */
+typedef struct
+{
+    int16_t  temp_c;        /* Die temperature, degree C */
+    uint16_t vdd_mv;        /* Supply voltage, mV, ILO_TRIM_TAG_UNKNOWN if not known */
+} ilo_trim_tag_t;
+
+/* Trim record, kept in retained RAM and in flash */
+typedef struct
+{
+    uint32_t       magic;   /* ILO_TRIM_RECORD_MAGIC */
+    uint32_t       crc;     /* CRC-32 of the record after this field */
+    uint32_t       trim;    /* ILO trim value */
+    uint32_t       freq;    /* ILO frequency measured with the trim, Hz */
+    ilo_trim_tag_t tag;
+    uint32_t       writes;  /* Number of flash writes of the record */
+} ilo_trim_record_t;
+
+/* Where the trim applied at boot came from */
+typedef enum
+{
+    ILO_TRIM_FROM_RETAINED = 0,     /* Retained RAM, warm reset */
+    ILO_TRIM_FROM_FLASH,            /* Flash record */
+    ILO_TRIM_FROM_MEASUREMENT,      /* Converged at this boot */
+    ILO_TRIM_NOT_CONVERGED          /* Measurement did not converge, trim not stored */
+} ilo_trim_source_t;
+
+/*******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+ilo_trim_source_t Ilo_Trim_Init(void);
+void Ilo_Trim_Poll(void);
+void Ilo_Trim_RequestRecal(void);
+bool Ilo_Trim_IsBusy(void);
+const ilo_trim_record_t * Ilo_Trim_GetRecord(void);
+void Ilo_Trim_GetTag(ilo_trim_tag_t *tag);
+
+#endif /* ILO_TRIM_H_ */
+
+
+/* [] END OF FILE */
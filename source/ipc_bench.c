@@ -0,0 +1,746 @@
+/******************************************************************************
+ * File Name:   ipc_bench.c
+ *
+ * Description: This file provides the IPC lock/notify benchmark. For every
+ * benchmark channel it checks the lock acquire/release and notify
+ * behaviour and measures the acquire and release cycles, the notify to
+ * interrupt latency and the cycles of one message with the CPU cycle
+ * counter. The results are kept per channel as min/max/mean and checked
+ * against the regression thresholds in ipc_bench.h.
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+#include <stdio.h>
+#include <string.h>
+#include "cy_pdl.h"
+#include "SelfTest.h"
+#include "ipc_bench.h"
+#include "cycle_counter.h"
+#include "telemetry.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+#define IPC_BENCH_IRQN      ((IRQn_Type)((uint32_t)cpuss_interrupts_ipc_dpslp_0_IRQn + IPC_BENCH_INTR))
+#define IPC_BENCH_INTR_MASK (1UL << IPC_BENCH_INTR)
+
+/* The waits of a periodic slice, two per iteration, with SelfTest_IPC() in
+ * the first slice, and the burst with the wait for its last messages must fit
+ * into the slice budget */
+typedef char ipc_bench_slice_waits_fit[((IPC_BENCH_SELFTEST_CYCLES +
+                                         (2u * IPC_BENCH_SLICE_ITERATIONS * IPC_BENCH_TIMEOUT_CYCLES)) <
+                                        IPC_BENCH_SLICE_BUDGET_CYCLES) ? 1 : -1];
+typedef char ipc_bench_burst_fits[((IPC_BENCH_BURST_CYCLES + IPC_BENCH_TIMEOUT_CYCLES) <
+                                   IPC_BENCH_SLICE_BUDGET_CYCLES) ? 1 : -1];
+
+/*******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+static void Ipc_Bench_Init(void);
+static void Ipc_Bench_Arm(void);
+static void Ipc_Bench_Disarm(void);
+static void Ipc_Bench_Isr(void);
+static void Ipc_Bench_StatAdd(ipc_bench_stat_t *stat, uint32_t cycles);
+static void Ipc_Bench_StatMerge(ipc_bench_stat_t *stat, const ipc_bench_stat_t *run);
+static bool Ipc_Bench_Wait(uint32_t index);
+static uint8_t Ipc_Bench_Check(const ipc_bench_result_t *result);
+
+/*******************************************************************************
+ * Global Variables
+ *******************************************************************************/
+static ipc_bench_result_t ipc_bench_results[IPC_BENCH_CHANNEL_COUNT];
+static ipc_bench_stat_t ipc_bench_burst;      /* Messages per burst */
+static uint32_t ipc_bench_notify_mask = 0u;   /* Notify events of the benchmark channels */
+static bool ipc_bench_initialized = false;
+static uint32_t ipc_bench_overhead = 0u;    /* Cycles of two back-to-back counter reads */
+static uint32_t ipc_bench_detail = 0u;
+
+/* Written by the notify interrupt */
+static volatile bool ipc_bench_notified[IPC_BENCH_CHANNEL_COUNT];
+static volatile uint32_t ipc_bench_notify_at[IPC_BENCH_CHANNEL_COUNT];
+static volatile uint32_t ipc_bench_received[IPC_BENCH_CHANNEL_COUNT];
+static volatile uint32_t ipc_bench_receive_count = 0u;
+
+/*******************************************************************************
+ * Function Definitions
+ *******************************************************************************/
+
+/*****************************************************************************
+ * Function Name: Ipc_Bench_Init
+ ******************************************************************************
+ * Summary:
+ * Installs the benchmark interrupt and calibrates the cycle counter
+ * overhead. The notify events are routed to the interrupt by
+ * Ipc_Bench_Arm() for each run.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+static void Ipc_Bench_Init(void)
+{
+    cy_stc_sysint_t intrCfg =
+    {
+            /*.intrSrc =*/ IPC_BENCH_IRQN,              /* IPC notify interrupt */
+            /*.intrPriority =*/ IPC_BENCH_IRQ_PRIORITY
+    };
+
+    for (uint32_t i = 0u; i < IPC_BENCH_CHANNEL_COUNT; i++)
+    {
+        ipc_bench_notify_mask |= 1UL << (IPC_BENCH_FIRST_CHANNEL + i);
+    }
+
+    Ipc_Bench_Disarm();
+
+    if (CY_SYSINT_SUCCESS != Cy_SysInt_Init(&intrCfg, Ipc_Bench_Isr))
+    {
+        CY_ASSERT(0);
+    }
+    NVIC_EnableIRQ(intrCfg.intrSrc);
+
+    ipc_bench_overhead = 0xFFFFFFFFUL;
+    for (uint32_t i = 0u; i < 8u; i++)
+    {
+        const uint32_t t0 = Cycle_Counter_Get();
+        const uint32_t t1 = Cycle_Counter_Get();
+
+        if ((t1 - t0) < ipc_bench_overhead)
+        {
+            ipc_bench_overhead = t1 - t0;
+        }
+    }
+
+    for (uint32_t i = 0u; i < IPC_BENCH_CHANNEL_COUNT; i++)
+    {
+        ipc_bench_results[i].acquire.min = 0xFFFFFFFFUL;
+        ipc_bench_results[i].release.min = 0xFFFFFFFFUL;
+        ipc_bench_results[i].notify.min = 0xFFFFFFFFUL;
+        ipc_bench_results[i].message.min = 0xFFFFFFFFUL;
+    }
+    ipc_bench_burst.min = 0xFFFFFFFFUL;
+
+    ipc_bench_initialized = true;
+}
+
+/*****************************************************************************
+ * Function Name: Ipc_Bench_Arm
+ ******************************************************************************
+ * Summary:
+ * Clears stale notify events and routes the notify events of the benchmark
+ * channels to the benchmark interrupt. Called at the start of every run, as
+ * SelfTest_IPC() and a previous failed run may have changed the mask.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+static void Ipc_Bench_Arm(void)
+{
+    IPC_INTR_STRUCT_Type *intr = Cy_IPC_Drv_GetIntrBaseAddr(IPC_BENCH_INTR);
+
+    Cy_IPC_Drv_ClearInterrupt(intr, CY_IPC_NO_NOTIFICATION, ipc_bench_notify_mask);
+    NVIC_ClearPendingIRQ(IPC_BENCH_IRQN);
+    for (uint32_t i = 0u; i < IPC_BENCH_CHANNEL_COUNT; i++)
+    {
+        ipc_bench_notified[i] = false;
+    }
+    Cy_IPC_Drv_SetInterruptMask(intr, CY_IPC_NO_NOTIFICATION, ipc_bench_notify_mask);
+}
+
+/*****************************************************************************
+ * Function Name: Ipc_Bench_Disarm
+ ******************************************************************************
+ * Summary:
+ * Masks and clears the notify events of the benchmark channels at the end of
+ * a run. A notification that was still pending after a timeout can then no
+ * longer release a lock, including one taken by a later run.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+static void Ipc_Bench_Disarm(void)
+{
+    IPC_INTR_STRUCT_Type *intr = Cy_IPC_Drv_GetIntrBaseAddr(IPC_BENCH_INTR);
+
+    Cy_IPC_Drv_SetInterruptMask(intr, CY_IPC_NO_NOTIFICATION, CY_IPC_NO_NOTIFICATION);
+    Cy_IPC_Drv_ClearInterrupt(intr, CY_IPC_NO_NOTIFICATION, ipc_bench_notify_mask);
+    NVIC_ClearPendingIRQ(IPC_BENCH_IRQN);
+}
+
+/*****************************************************************************
+ * Function Name: Ipc_Bench_Isr
+ ******************************************************************************
+ * Summary:
+ * Notify interrupt. Takes the timestamp first, then reads the message and
+ * releases the lock of every notifying channel, as a receiver would.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+static void Ipc_Bench_Isr(void)
+{
+    const uint32_t now = Cycle_Counter_Get();
+    IPC_INTR_STRUCT_Type *intr = Cy_IPC_Drv_GetIntrBaseAddr(IPC_BENCH_INTR);
+    const uint32_t notify = Cy_IPC_Drv_ExtractAcquireMask(Cy_IPC_Drv_GetInterruptStatusMasked(intr));
+
+    Cy_IPC_Drv_ClearInterrupt(intr, CY_IPC_NO_NOTIFICATION, notify);
+
+    for (uint32_t i = 0u; i < IPC_BENCH_CHANNEL_COUNT; i++)
+    {
+        if (0u != (notify & (1UL << (IPC_BENCH_FIRST_CHANNEL + i))))
+        {
+            IPC_STRUCT_Type *ipc = Cy_IPC_Drv_GetIpcBaseAddress(IPC_BENCH_FIRST_CHANNEL + i);
+            uint32_t message = 0u;
+
+            (void)Cy_IPC_Drv_ReadMsgWord(ipc, &message);
+            ipc_bench_received[i] = message;
+            ipc_bench_notify_at[i] = now;
+            (void)Cy_IPC_Drv_LockRelease(ipc, CY_IPC_NO_NOTIFICATION);
+            ipc_bench_notified[i] = true;
+            ipc_bench_receive_count++;
+        }
+    }
+}
+
+/*****************************************************************************
+ * Function Name: Ipc_Bench_StatAdd
+ ******************************************************************************
+ * Summary:
+ * Adds a measurement to a statistic.
+ *
+ * Parameters:
+ *  stat   : Statistic
+ *  cycles : Measured cycles
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+static void Ipc_Bench_StatAdd(ipc_bench_stat_t *stat, uint32_t cycles)
+{
+    if (cycles < stat->min)
+    {
+        stat->min = cycles;
+    }
+    if (cycles > stat->max)
+    {
+        stat->max = cycles;
+    }
+    stat->count++;
+    stat->sum += cycles;
+}
+
+/*****************************************************************************
+ * Function Name: Ipc_Bench_StatMerge
+ ******************************************************************************
+ * Summary:
+ * Adds the statistic of one run to the accumulated statistic.
+ *
+ * Parameters:
+ *  stat : Accumulated statistic
+ *  run  : Statistic of one run
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+static void Ipc_Bench_StatMerge(ipc_bench_stat_t *stat, const ipc_bench_stat_t *run)
+{
+    if (0u == run->count)
+    {
+        return;
+    }
+    if (run->min < stat->min)
+    {
+        stat->min = run->min;
+    }
+    if (run->max > stat->max)
+    {
+        stat->max = run->max;
+    }
+    stat->count += run->count;
+    stat->sum += run->sum;
+}
+
+/*****************************************************************************
+ * Function Name: Ipc_Bench_Wait
+ ******************************************************************************
+ * Summary:
+ * Waits for the notify interrupt of a channel.
+ *
+ * Parameters:
+ *  index : Benchmark channel index
+ *
+ * Return:
+ *  bool : false on timeout
+ *****************************************************************************/
+static bool Ipc_Bench_Wait(uint32_t index)
+{
+    const uint32_t start = Cycle_Counter_Get();
+
+    while (!ipc_bench_notified[index])
+    {
+        if ((Cycle_Counter_Get() - start) > IPC_BENCH_TIMEOUT_CYCLES)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*****************************************************************************
+ * Function Name: Ipc_Bench_Check
+ ******************************************************************************
+ * Summary:
+ * Checks the results of one run against the thresholds.
+ *
+ * Parameters:
+ *  result : Results of the run
+ *
+ * Return:
+ *  uint8_t : IPC_BENCH_FAIL_NONE or the exceeded threshold
+ *****************************************************************************/
+static uint8_t Ipc_Bench_Check(const ipc_bench_result_t *result)
+{
+    uint8_t fail = IPC_BENCH_FAIL_NONE;
+
+    if (result->acquire.max > IPC_BENCH_MAX_ACQUIRE_CYCLES)
+    {
+        fail = IPC_BENCH_FAIL_ACQUIRE;
+    }
+    else if (result->release.max > IPC_BENCH_MAX_RELEASE_CYCLES)
+    {
+        fail = IPC_BENCH_FAIL_RELEASE;
+    }
+    else if (result->notify.max > IPC_BENCH_MAX_NOTIFY_CYCLES)
+    {
+        fail = IPC_BENCH_FAIL_LATENCY;
+    }
+    else if (Ipc_Bench_Mean(&result->message) > IPC_BENCH_MAX_MESSAGE_CYCLES)
+    {
+        fail = IPC_BENCH_FAIL_MESSAGE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    return fail;
+}
+
+/*****************************************************************************
+ * Function Name: Ipc_Bench_Channel
+ ******************************************************************************
+ * Summary:
+ * Checks and measures one benchmark channel:
+ * - the channel is free, acquiring it succeeds, a second acquire fails, and
+ *   releasing it frees it again (acquire and release cycles)
+ * - a notification reaches the interrupt with the written message (notify
+ *   latency)
+ * - Cy_IPC_Drv_SendMsgWord() until the receiver released the channel
+ *   (message cycles)
+ *
+ * Parameters:
+ *  index      : Benchmark channel index, 0 .. IPC_BENCH_CHANNEL_COUNT - 1
+ *  iterations : Number of measurements of each kind
+ *
+ * Return:
+ *  uint8_t : OK_STATUS, or ERROR_STATUS on a failed check or an exceeded
+ *  threshold (see Ipc_Bench_GetDetail())
+ *****************************************************************************/
+uint8_t Ipc_Bench_Channel(uint32_t index, uint32_t iterations)
+{
+    IPC_STRUCT_Type *ipc = Cy_IPC_Drv_GetIpcBaseAddress(IPC_BENCH_FIRST_CHANNEL + index);
+    ipc_bench_result_t *result = &ipc_bench_results[index];
+    ipc_bench_result_t run;
+    uint8_t fail = IPC_BENCH_FAIL_NONE;
+    bool held = false;      /* Lock held by an unanswered notification */
+
+    if (!ipc_bench_initialized)
+    {
+        Ipc_Bench_Init();
+    }
+    Ipc_Bench_Arm();
+
+    (void)memset(&run, 0, sizeof(run));
+    run.acquire.min = 0xFFFFFFFFUL;
+    run.release.min = 0xFFFFFFFFUL;
+    run.notify.min = 0xFFFFFFFFUL;
+    run.message.min = 0xFFFFFFFFUL;
+
+    for (uint32_t i = 0u; (i < iterations) && (IPC_BENCH_FAIL_NONE == fail); i++)
+    {
+        const uint32_t message = (index << 24u) | i;
+        cy_en_ipcdrv_status_t status;
+        uint32_t t0;
+        uint32_t t1;
+
+        /* Lock behaviour, acquire and release cycles */
+        if (Cy_IPC_Drv_IsLockAcquired(ipc))
+        {
+            fail = IPC_BENCH_FAIL_LOCK;
+            break;
+        }
+        t0 = Cycle_Counter_Get();
+        status = Cy_IPC_Drv_LockAcquire(ipc);
+        t1 = Cycle_Counter_Get();
+        if ((CY_IPC_DRV_SUCCESS != status) || !Cy_IPC_Drv_IsLockAcquired(ipc) ||
+            (CY_IPC_DRV_SUCCESS == Cy_IPC_Drv_LockAcquire(ipc)))
+        {
+            (void)Cy_IPC_Drv_LockRelease(ipc, CY_IPC_NO_NOTIFICATION);
+            fail = IPC_BENCH_FAIL_LOCK;
+            break;
+        }
+        Ipc_Bench_StatAdd(&run.acquire, t1 - t0 - ipc_bench_overhead);
+
+        t0 = Cycle_Counter_Get();
+        status = Cy_IPC_Drv_LockRelease(ipc, CY_IPC_NO_NOTIFICATION);
+        t1 = Cycle_Counter_Get();
+        if ((CY_IPC_DRV_SUCCESS != status) || Cy_IPC_Drv_IsLockAcquired(ipc))
+        {
+            fail = IPC_BENCH_FAIL_LOCK;
+            break;
+        }
+        Ipc_Bench_StatAdd(&run.release, t1 - t0 - ipc_bench_overhead);
+
+        /* Notify to interrupt latency, the interrupt releases the lock */
+        ipc_bench_notified[index] = false;
+        if (CY_IPC_DRV_SUCCESS != Cy_IPC_Drv_LockAcquire(ipc))
+        {
+            fail = IPC_BENCH_FAIL_LOCK;
+            break;
+        }
+        Cy_IPC_Drv_WriteDataValue(ipc, message);
+        t0 = Cycle_Counter_Get();
+        Cy_IPC_Drv_AcquireNotify(ipc, IPC_BENCH_INTR_MASK);
+        if (!Ipc_Bench_Wait(index) || (message != ipc_bench_received[index]))
+        {
+            held = true;
+            fail = IPC_BENCH_FAIL_NOTIFY;
+            break;
+        }
+        Ipc_Bench_StatAdd(&run.notify, ipc_bench_notify_at[index] - t0 - ipc_bench_overhead);
+
+        /* One message: send, receive, release */
+        ipc_bench_notified[index] = false;
+        t0 = Cycle_Counter_Get();
+        status = Cy_IPC_Drv_SendMsgWord(ipc, IPC_BENCH_INTR_MASK, ~message);
+        if ((CY_IPC_DRV_SUCCESS != status) || !Ipc_Bench_Wait(index) || ((~message) != ipc_bench_received[index]))
+        {
+            /* Sent but not received, the lock is still held */
+            held = (CY_IPC_DRV_SUCCESS == status);
+            fail = IPC_BENCH_FAIL_NOTIFY;
+            break;
+        }
+        while (Cy_IPC_Drv_IsLockAcquired(ipc)) {}
+        t1 = Cycle_Counter_Get();
+        Ipc_Bench_StatAdd(&run.message, t1 - t0 - ipc_bench_overhead);
+    }
+
+    /* A late interrupt cannot release the lock after this */
+    Ipc_Bench_Disarm();
+    if (held)
+    {
+        (void)Cy_IPC_Drv_LockRelease(ipc, CY_IPC_NO_NOTIFICATION);
+    }
+
+    if (IPC_BENCH_FAIL_NONE == fail)
+    {
+        fail = Ipc_Bench_Check(&run);
+    }
+
+    Ipc_Bench_StatMerge(&result->acquire, &run.acquire);
+    Ipc_Bench_StatMerge(&result->release, &run.release);
+    Ipc_Bench_StatMerge(&result->notify, &run.notify);
+    Ipc_Bench_StatMerge(&result->message, &run.message);
+
+    if (IPC_BENCH_FAIL_NONE != fail)
+    {
+        result->failures++;
+        ipc_bench_detail = ((IPC_BENCH_FIRST_CHANNEL + index) << 8u) | fail;
+        return ERROR_STATUS;
+    }
+
+    return OK_STATUS;
+}
+
+/*****************************************************************************
+ * Function Name: Ipc_Bench_Burst
+ ******************************************************************************
+ * Summary:
+ * Measures the sustained message throughput: sends messages back to back,
+ * round robin over all benchmark channels, for IPC_BENCH_BURST_CYCLES. A
+ * channel takes its next message as soon as the receiver released it. The
+ * messages received within the burst are the throughput; every message sent
+ * must be received.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint8_t : OK_STATUS, or ERROR_STATUS on a lost message or a throughput
+ *  below IPC_BENCH_MIN_BURST_MESSAGES (see Ipc_Bench_GetDetail())
+ *****************************************************************************/
+uint8_t Ipc_Bench_Burst(void)
+{
+    uint32_t first;
+    uint32_t sent = 0u;
+    uint32_t received;
+    uint32_t channel = 0u;
+    uint32_t start;
+    uint8_t fail = IPC_BENCH_FAIL_NONE;
+
+    if (!ipc_bench_initialized)
+    {
+        Ipc_Bench_Init();
+    }
+    Ipc_Bench_Arm();
+
+    first = ipc_bench_receive_count;
+    start = Cycle_Counter_Get();
+    while ((Cycle_Counter_Get() - start) < IPC_BENCH_BURST_CYCLES)
+    {
+        IPC_STRUCT_Type *ipc = Cy_IPC_Drv_GetIpcBaseAddress(IPC_BENCH_FIRST_CHANNEL + channel);
+
+        /* Fails while the previous message of the channel is not released */
+        if (CY_IPC_DRV_SUCCESS == Cy_IPC_Drv_SendMsgWord(ipc, IPC_BENCH_INTR_MASK, sent))
+        {
+            sent++;
+        }
+        channel = (channel + 1u) % IPC_BENCH_CHANNEL_COUNT;
+    }
+    received = ipc_bench_receive_count - first;
+
+    /* Messages still in flight */
+    start = Cycle_Counter_Get();
+    while ((ipc_bench_receive_count - first) != sent)
+    {
+        if ((Cycle_Counter_Get() - start) > IPC_BENCH_TIMEOUT_CYCLES)
+        {
+            break;
+        }
+    }
+
+    /* A late interrupt cannot release a lock after this */
+    Ipc_Bench_Disarm();
+
+    if ((ipc_bench_receive_count - first) != sent)
+    {
+        fail = IPC_BENCH_FAIL_NOTIFY;
+        ipc_bench_detail = (IPC_BENCH_BURST_CHANNEL << 8u) | fail;
+        for (uint32_t i = 0u; i < IPC_BENCH_CHANNEL_COUNT; i++)
+        {
+            IPC_STRUCT_Type *ipc = Cy_IPC_Drv_GetIpcBaseAddress(IPC_BENCH_FIRST_CHANNEL + i);
+
+            if (Cy_IPC_Drv_IsLockAcquired(ipc))
+            {
+                ipc_bench_detail = ((IPC_BENCH_FIRST_CHANNEL + i) << 8u) | fail;
+                (void)Cy_IPC_Drv_LockRelease(ipc, CY_IPC_NO_NOTIFICATION);
+            }
+        }
+        return ERROR_STATUS;
+    }
+
+    Ipc_Bench_StatAdd(&ipc_bench_burst, received);
+    if (received < IPC_BENCH_MIN_BURST_MESSAGES)
+    {
+        ipc_bench_detail = (IPC_BENCH_BURST_CHANNEL << 8u) | IPC_BENCH_FAIL_BURST;
+        return ERROR_STATUS;
+    }
+
+    return OK_STATUS;
+}
+
+/*****************************************************************************
+ * Function Name: Ipc_Bench_Run
+ ******************************************************************************
+ * Summary:
+ * Runs Ipc_Bench_Channel() on all benchmark channels, then
+ * IPC_BENCH_BURST_RUNS bursts over all channels.
+ *
+ * Parameters:
+ *  iterations : Number of measurements of each kind per channel
+ *
+ * Return:
+ *  uint8_t : OK_STATUS, or ERROR_STATUS if a channel failed
+ *****************************************************************************/
+uint8_t Ipc_Bench_Run(uint32_t iterations)
+{
+    uint8_t ret = OK_STATUS;
+
+    for (uint32_t i = 0u; i < IPC_BENCH_CHANNEL_COUNT; i++)
+    {
+        if (OK_STATUS != Ipc_Bench_Channel(i, iterations))
+        {
+            ret = ERROR_STATUS;
+        }
+    }
+
+    for (uint32_t i = 0u; i < IPC_BENCH_BURST_RUNS; i++)
+    {
+        if (OK_STATUS != Ipc_Bench_Burst())
+        {
+            ret = ERROR_STATUS;
+        }
+    }
+
+    return ret;
+}
+
+/*****************************************************************************
+ * Function Name: Ipc_Bench_GetResult
+ ******************************************************************************
+ * Summary:
+ * Returns the results of a benchmark channel, accumulated over all runs.
+ *
+ * Parameters:
+ *  index : Benchmark channel index
+ *
+ * Return:
+ *  const ipc_bench_result_t * : Results, NULL for an invalid index
+ *****************************************************************************/
+const ipc_bench_result_t * Ipc_Bench_GetResult(uint32_t index)
+{
+    return (index < IPC_BENCH_CHANNEL_COUNT) ? &ipc_bench_results[index] : NULL;
+}
+
+/*****************************************************************************
+ * Function Name: Ipc_Bench_GetBurst
+ ******************************************************************************
+ * Summary:
+ * Returns the messages received per burst of IPC_BENCH_BURST_CYCLES, over
+ * all bursts.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  const ipc_bench_stat_t * : Messages per burst
+ *****************************************************************************/
+const ipc_bench_stat_t * Ipc_Bench_GetBurst(void)
+{
+    return &ipc_bench_burst;
+}
+
+/*****************************************************************************
+ * Function Name: Ipc_Bench_GetDetail
+ ******************************************************************************
+ * Summary:
+ * Returns the channel and reason of the last failure.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint32_t : (IPC channel << 8) | IPC_BENCH_FAIL_xxx, 0 if nothing failed
+ *****************************************************************************/
+uint32_t Ipc_Bench_GetDetail(void)
+{
+    return ipc_bench_detail;
+}
+
+/*****************************************************************************
+ * Function Name: Ipc_Bench_Mean
+ ******************************************************************************
+ * Summary:
+ * Returns the mean of a statistic.
+ *
+ * Parameters:
+ *  stat : Statistic
+ *
+ * Return:
+ *  uint32_t : Mean cycles, 0 without measurements
+ *****************************************************************************/
+uint32_t Ipc_Bench_Mean(const ipc_bench_stat_t *stat)
+{
+    return (0u != stat->count) ? (uint32_t)(stat->sum / stat->count) : 0u;
+}
+
+/*****************************************************************************
+ * Function Name: Ipc_Bench_Print
+ ******************************************************************************
+ * Summary:
+ * Prints min/mean/max cycles of all benchmark channels and the messages per
+ * burst over all channels. Queued telemetry frames are sent first.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+void Ipc_Bench_Print(void)
+{
+    Telemetry_Flush();
+    printf("IPC cycles (min/mean/max)  acquire         release         notify          message\r\n");
+
+    for (uint32_t i = 0u; i < IPC_BENCH_CHANNEL_COUNT; i++)
+    {
+        const ipc_bench_result_t *r = &ipc_bench_results[i];
+
+        if (0u == r->acquire.count)
+        {
+            continue;
+        }
+        printf("  channel %-2lu               %lu/%lu/%lu  %lu/%lu/%lu  %lu/%lu/%lu  %lu/%lu/%lu\r\n",
+               (unsigned long)(IPC_BENCH_FIRST_CHANNEL + i),
+               (unsigned long)r->acquire.min, (unsigned long)Ipc_Bench_Mean(&r->acquire), (unsigned long)r->acquire.max,
+               (unsigned long)r->release.min, (unsigned long)Ipc_Bench_Mean(&r->release), (unsigned long)r->release.max,
+               (unsigned long)r->notify.min, (unsigned long)Ipc_Bench_Mean(&r->notify), (unsigned long)r->notify.max,
+               (unsigned long)r->message.min, (unsigned long)Ipc_Bench_Mean(&r->message), (unsigned long)r->message.max);
+    }
+
+    if (0u != ipc_bench_burst.count)
+    {
+        printf("IPC messages per %lu cycles, all channels (min/mean/max)  %lu/%lu/%lu\r\n",
+               (unsigned long)IPC_BENCH_BURST_CYCLES, (unsigned long)ipc_bench_burst.min,
+               (unsigned long)Ipc_Bench_Mean(&ipc_bench_burst), (unsigned long)ipc_bench_burst.max);
+    }
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,165 @@
+/******************************************************************************
+ * File Name:   ipc_bench.h
+ *
+ * Description: This file provides the IPC lock/notify benchmark that extends
+ * the IPC self test with cycle measurements and regression thresholds.
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+/*******************************************************************************
+ * Include guard
+ *******************************************************************************/
+#ifndef IPC_BENCH_H_
+#define IPC_BENCH_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+/* IPC channels and interrupt structure used by the benchmark. They must not
+ * be used by the system or the application. */
+#ifndef IPC_BENCH_FIRST_CHANNEL
+#define IPC_BENCH_FIRST_CHANNEL         (4u)
+#endif
+#ifndef IPC_BENCH_CHANNEL_COUNT
+#define IPC_BENCH_CHANNEL_COUNT         (4u)
+#endif
+#ifndef IPC_BENCH_INTR
+#define IPC_BENCH_INTR                  (4u)
+#endif
+#define IPC_BENCH_IRQ_PRIORITY          (1u)
+
+/* Iterations per channel at start-up and per periodic slice */
+#define IPC_BENCH_ITERATIONS            (32u)
+#define IPC_BENCH_SLICE_ITERATIONS      (4u)
+
+/* Length of one message burst over all channels, and bursts at start-up */
+#define IPC_BENCH_BURST_CYCLES          (12000u)
+#define IPC_BENCH_BURST_RUNS            (4u)
+
+/* Periodic slices: one per channel, then one burst */
+#define IPC_BENCH_SLICE_COUNT           (IPC_BENCH_CHANNEL_COUNT + 1u)
+
+/* Cycles of one periodic slice, keep equal to the "IPC Test" budget in
+ * test_schedule_cfg.h. The waits of a slice, each up to
+ * IPC_BENCH_TIMEOUT_CYCLES, and SelfTest_IPC() in the first slice must fit
+ * into it. */
+#define IPC_BENCH_SLICE_BUDGET_CYCLES   (15000u)
+
+/* Worst case cycles of SelfTest_IPC(), estimate for 180 MHz. Replace with
+ * the value measured in the first "IPC Test" slice of a PERF_BENCH build. */
+#define IPC_BENCH_SELFTEST_CYCLES       (2000u)
+
+/* Regression thresholds in CPU cycles. The worst case of acquire, release
+ * and notify latency, and the mean cycles of one message, fail the test when
+ * exceeded. Interrupts of higher priority add to the latency. */
+#ifndef IPC_BENCH_MAX_ACQUIRE_CYCLES
+#define IPC_BENCH_MAX_ACQUIRE_CYCLES    (200u)
+#endif
+#ifndef IPC_BENCH_MAX_RELEASE_CYCLES
+#define IPC_BENCH_MAX_RELEASE_CYCLES    (200u)
+#endif
+#ifndef IPC_BENCH_MAX_NOTIFY_CYCLES
+#define IPC_BENCH_MAX_NOTIFY_CYCLES     (1500u)
+#endif
+#ifndef IPC_BENCH_MAX_MESSAGE_CYCLES
+#define IPC_BENCH_MAX_MESSAGE_CYCLES    (3000u)
+#endif
+/* Fewest messages received in one burst of IPC_BENCH_BURST_CYCLES */
+#ifndef IPC_BENCH_MIN_BURST_MESSAGES
+#define IPC_BENCH_MIN_BURST_MESSAGES    (8u)
+#endif
+
+/* Longest wait for the notify interrupt. A later notification exceeds
+ * IPC_BENCH_MAX_NOTIFY_CYCLES anyway, so waiting longer only stretches the
+ * slice. */
+#define IPC_BENCH_TIMEOUT_CYCLES        (IPC_BENCH_MAX_NOTIFY_CYCLES)
+
+/* Failure reasons, in bits 0..7 of Ipc_Bench_GetDetail(); bits 8..15 hold
+ * the channel, IPC_BENCH_BURST_CHANNEL for the burst throughput */
+#define IPC_BENCH_FAIL_NONE             (0u)
+#define IPC_BENCH_FAIL_LOCK             (1u)    /* Lock acquire/release behaviour */
+#define IPC_BENCH_FAIL_NOTIFY           (2u)    /* Missing or wrong notification */
+#define IPC_BENCH_FAIL_ACQUIRE          (3u)    /* Acquire threshold exceeded */
+#define IPC_BENCH_FAIL_RELEASE          (4u)    /* Release threshold exceeded */
+#define IPC_BENCH_FAIL_LATENCY          (5u)    /* Notify latency threshold exceeded */
+#define IPC_BENCH_FAIL_MESSAGE          (6u)    /* Message cycles threshold exceeded */
+#define IPC_BENCH_FAIL_BURST            (7u)    /* Burst throughput below threshold */
+#define IPC_BENCH_BURST_CHANNEL         (0xFFu)
+
+/*******************************************************************************
+ * Data Types
+ *******************************************************************************/
+/* Cycle statistics of one measurement */
+typedef struct
+{
+    uint32_t min;
+    uint32_t max;
+    uint32_t count;
+    uint64_t sum;
+} ipc_bench_stat_t;
+
+/* Results of one channel, accumulated over all runs */
+typedef struct
+{
+    ipc_bench_stat_t acquire;   /* Cy_IPC_Drv_LockAcquire() */
+    ipc_bench_stat_t release;   /* Cy_IPC_Drv_LockRelease() */
+    ipc_bench_stat_t notify;    /* Notify to start of the interrupt handler */
+    ipc_bench_stat_t message;   /* Message sent until received and released */
+    uint32_t         failures;  /* Failed runs */
+} ipc_bench_result_t;
+
+/*******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+uint8_t Ipc_Bench_Channel(uint32_t index, uint32_t iterations);
+uint8_t Ipc_Bench_Burst(void);
+uint8_t Ipc_Bench_Run(uint32_t iterations);
+const ipc_bench_result_t * Ipc_Bench_GetResult(uint32_t index);
+const ipc_bench_stat_t * Ipc_Bench_GetBurst(void);
+uint32_t Ipc_Bench_GetDetail(void);
+uint32_t Ipc_Bench_Mean(const ipc_bench_stat_t *stat);
+void Ipc_Bench_Print(void);
+
+#endif /* IPC_BENCH_H_ */
+
+
+/* [] END OF FILE */
@@ -51,6 +51,15 @@
 #include "mtb_hal.h"
 #include <stdio.h>
 #include "self_test.h"
+#include "fault_journal.h"
+#include "cycle_counter.h"
+#include "telemetry.h"
+#include "test_low_power.h"
+#include "ilo_trim.h"
+#include "clock_monitor.h"
+#include "ipc_bench.h"
+#include "fpu_slice_test.h"
+#include "perf_bench.h"
 
 /*******************************************************************************
  * Macros
@@ -64,6 +73,12 @@
 static cy_stc_scb_uart_context_t    DEBUG_UART_context;           /** UART context */
 static mtb_hal_uart_t               DEBUG_UART_hal_obj;           /** Debug UART HAL object  */
 
+/* Printed names of ilo_trim_source_t */
+static const char * const ilo_trim_source_names[] =
+{
+    "from retained RAM", "from flash", "measured", "not converged"
+};
+
 /*******************************************************************************
  * Function Prototypes
  *******************************************************************************/
@@ -92,6 +107,7 @@ int main(void)
     cy_rslt_t result;
     /* SelfTest API return status */
     uint8_t ret = ERROR_STATUS;
+    ilo_trim_source_t ilo_trim_source;
 
     /* Initialize the device and board peripherals */
     result = cybsp_init();
@@ -136,6 +152,18 @@ int main(void)
         CY_ASSERT(0);
     }
 
+    /* Cycle counter, time base of the fault journal records */
+    Cycle_Counter_Init();
+
+    /* Locate the fault journal head in flash and record this boot */
+    Fault_Journal_Init();
+
+    /* Apply the stored ILO trim, measures the ILO only if there is none */
+    ilo_trim_source = Ilo_Trim_Init();
+
+    /* Binary telemetry stream, used when TELEMETRY_MODE is TELEMETRY_BINARY */
+    Telemetry_Init();
+
     /* Enable global interrupts */
     __enable_irq();
 
@@ -176,9 +204,13 @@ int main(void)
     /* DMA DW Test */
     DMA_DW_Test();
 
-    /* IPC Test */
+    /* IPC Test, extended by the lock/notify benchmark */
     ret = SelfTest_IPC();
-    PRINT_TEST_RESULT(ip_index++, "IPC Test", ret);
+    if (ERROR_STATUS != ret)
+    {
+        ret = Ipc_Bench_Run(IPC_BENCH_ITERATIONS);
+    }
+    PRINT_TEST_RESULT_DETAIL(ip_index++, "IPC Test", ret, Ipc_Bench_GetDetail());
 
     /* Clock Test */
     Clock_Test();
@@ -198,13 +230,68 @@ int main(void)
     /* Flash Test */
     Flash_Test();
 
+#if (TELEMETRY_MODE == TELEMETRY_BINARY)
+    Telemetry_Counter(TELEMETRY_COUNTER_TESTS, (uint32_t)ip_index - 1u);
+    Telemetry_Counter(TELEMETRY_COUNTER_JOURNAL_DROP, Fault_Journal_GetDropped());
+    Telemetry_Counter(TELEMETRY_COUNTER_STARTUP_CYCLES, startup_test_cycles);
+#if (STARTUP_CFG_REGS_MODE == CFG_REGS_TO_FLASH_MODE)
+    Telemetry_Counter(TELEMETRY_COUNTER_SNAPSHOT_WRITES, startup_cfg_writes);
+#endif
+    Telemetry_Flush();
+#endif
+
     printf("------------------------------------------------------- \r\n\n");
     printf("END of the Core CPU Test.\r\n\n");
     printf("Total number of IPs covered in the Test      %d\r\n", --ip_index);
 
+    /* Store the failures of this boot in the fault journal */
+    if (!Fault_Journal_Flush())
+    {
+        printf("Error: Can't write the fault journal\r\n");
+    }
+    printf("Fault journal boot number                    %u\r\n", Fault_Journal_GetBoot());
+    printf("ILO trim                                     %s, %lu Hz\r\n",
+           ilo_trim_source_names[ilo_trim_source], (unsigned long)Ilo_Trim_GetRecord()->freq);
+#if (STARTUP_CFG_REGS_MODE == CFG_REGS_TO_FLASH_MODE)
+    printf("Start-up register test                       %lu cycles, snapshot %s (%lu writes)\r\n",
+           (unsigned long)startup_test_cycles, startup_cfg_saved ? "saved" : "unchanged",
+           (unsigned long)startup_cfg_writes);
+#else
+    printf("Start-up register test                       %lu cycles\r\n", (unsigned long)startup_test_cycles);
+#endif
+    printf("FPU register test slice                      %lu cycles, %lu cycles interrupts off\r\n",
+           (unsigned long)Fpu_Slice_GetStats()->max_cycles, (unsigned long)Fpu_Slice_GetStats()->max_irq_off);
+    Ipc_Bench_Print();
+
+#if (PERF_BENCH != 0u)
+    /* Cycles and interrupt-off time of the periodic tests, checked against
+     * the budgets with tools/perf_compare.py */
+    if (!Scheduled_Test_Bench(PERF_BENCH_ITERATIONS))
+    {
+        Telemetry_Flush();
+        printf("Error: Periodic tests exceed the test table, the schedule is not valid\r\n");
+    }
+#endif
+
+    /* Repeat the tests within their diagnostic intervals */
+    (void)Scheduled_Test_Init();
+#if (TEST_LOW_POWER != 0u)
+    Test_LowPower_Init();
+#endif
+
     for (;;)
     {
         /* Idle loop */
+        (void)Fault_Journal_Flush();
+        Ilo_Trim_Poll();
+        Clock_Monitor_Poll();
+        Telemetry_Poll();
+#if (TEST_LOW_POWER != 0u)
+        /* Runs the due slices and sleeps until the next wake-up */
+        Test_LowPower_Run();
+#else
+        Scheduled_Test_Run();
+#endif
     }
 
 }
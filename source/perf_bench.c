@@ -0,0 +1,180 @@
+/******************************************************************************
+ * File Name:   perf_bench.c
+ *
+ * Description: This file provides the benchmark that measures the cycles and
+ * the interrupt-off time of the periodic test slices.
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+#include <stdio.h>
+#include "cy_pdl.h"
+#include "SelfTest.h"
+#include "perf_bench.h"
+#include "cycle_counter.h"
+#include "telemetry.h"
+
+/*******************************************************************************
+ * Global Variables
+ *******************************************************************************/
+/* Time of the last probe interrupt and the longest gap between two */
+static volatile uint32_t perf_bench_probe_last = 0u;
+static volatile uint32_t perf_bench_probe_gap = 0u;
+
+/*******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+static void Perf_Bench_Probe(void);
+
+/*******************************************************************************
+ * Function Definitions
+ *******************************************************************************/
+
+/*****************************************************************************
+ * Function Name: Perf_Bench_Probe
+ ******************************************************************************
+ * Summary:
+ * SysTick callback, records the longest time between two probe interrupts.
+ * A gap longer than the probe period means that interrupts were disabled.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+static void Perf_Bench_Probe(void)
+{
+    const uint32_t now = Cycle_Counter_Get();
+    const uint32_t gap = now - perf_bench_probe_last;
+
+    if (gap > perf_bench_probe_gap)
+    {
+        perf_bench_probe_gap = gap;
+    }
+    perf_bench_probe_last = now;
+}
+
+/*****************************************************************************
+ * Function Name: Perf_Bench_Measure
+ ******************************************************************************
+ * Summary:
+ * Calls a slice function iterations times and measures the cycles of every
+ * call. Then calls it iterations times more with the SysTick probe running
+ * and measures the longest interrupt-off window, with a resolution of
+ * PERF_BENCH_PROBE_CYCLES. Uses the SysTick, so call it before
+ * Scheduled_Test_Init().
+ *
+ * Parameters:
+ *  func       : Slice function
+ *  iterations : Calls per measurement
+ *  result     : Filled with the results, bytes is left unchanged
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+void Perf_Bench_Measure(test_slice_func_t func, uint32_t iterations, perf_bench_result_t *result)
+{
+    result->iterations = iterations;
+    result->min_cycles = UINT32_MAX;
+    result->max_cycles = 0u;
+    result->sum_cycles = 0u;
+    result->failures = 0u;
+
+    for (uint32_t i = 0u; i < iterations; i++)
+    {
+        const uint32_t start = Cycle_Counter_Get();
+        const uint8_t ret = func();
+        const uint32_t cycles = Cycle_Counter_Get() - start;
+
+        if ((OK_STATUS != ret) && (PASS_COMPLETE_STATUS != ret) && (PASS_STILL_TESTING_STATUS != ret))
+        {
+            result->failures++;
+        }
+        result->min_cycles = (cycles < result->min_cycles) ? cycles : result->min_cycles;
+        result->max_cycles = (cycles > result->max_cycles) ? cycles : result->max_cycles;
+        result->sum_cycles += cycles;
+    }
+
+    /* Interrupt-off windows, measured separately so the probe interrupts do
+     * not add to the slice cycles */
+    perf_bench_probe_gap = 0u;
+    perf_bench_probe_last = Cycle_Counter_Get();
+    Cy_SysTick_Init(CY_SYSTICK_CLOCK_SOURCE_CLK_CPU, PERF_BENCH_PROBE_CYCLES - 1u);
+    Cy_SysTick_SetCallback(0u, Perf_Bench_Probe);
+
+    for (uint32_t i = 0u; i < iterations; i++)
+    {
+        (void)func();
+    }
+
+    Cy_SysTick_Disable();
+    Cy_SysTick_SetCallback(0u, NULL);
+    result->irq_off = (perf_bench_probe_gap > PERF_BENCH_PROBE_CYCLES) ?
+                      (perf_bench_probe_gap - PERF_BENCH_PROBE_CYCLES) : 0u;
+}
+
+/*****************************************************************************
+ * Function Name: Perf_Bench_Print
+ ******************************************************************************
+ * Summary:
+ * Prints one result line, see PERF_BENCH_TAG. Queued telemetry frames are
+ * sent first.
+ *
+ * Parameters:
+ *  name   : Test name
+ *  result : Results of Perf_Bench_Measure()
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+void Perf_Bench_Print(const char *name, const perf_bench_result_t *result)
+{
+    const uint32_t mean = (0u != result->iterations) ?
+                          (uint32_t)(result->sum_cycles / result->iterations) : 0u;
+
+    Telemetry_Flush();
+    printf(PERF_BENCH_TAG ",%s,%lu,%lu,%lu,%lu,%lu,%lu,%lu\r\n", name,
+           (unsigned long)result->iterations, (unsigned long)result->min_cycles,
+           (unsigned long)mean, (unsigned long)result->max_cycles,
+           (unsigned long)result->bytes, (unsigned long)result->irq_off,
+           (unsigned long)result->failures);
+}
+
+
+/* [] END OF FILE */
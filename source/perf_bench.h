@@ -0,0 +1,103 @@
+/******************************************************************************
+ * File Name:   perf_bench.h
+ *
+ * Description: This file provides the benchmark that measures the cycles and
+ * the interrupt-off time of the periodic test slices.
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+/*******************************************************************************
+ * Include guard
+ *******************************************************************************/
+#ifndef PERF_BENCH_H_
+#define PERF_BENCH_H_
+
+#include <stdint.h>
+#include "test_schedule.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+/* Build with DEFINES+=PERF_BENCH=1 to benchmark the periodic tests at
+ * start-up. Off by default, the benchmark adds several seconds to the boot. */
+#ifndef PERF_BENCH
+#define PERF_BENCH                      (0u)
+#endif
+
+/* Slice calls per test, for the cycle and for the interrupt-off measurement */
+#ifndef PERF_BENCH_ITERATIONS
+#define PERF_BENCH_ITERATIONS           (64u)
+#endif
+
+/* SysTick probe period, in CPU cycles. Interrupt-off windows are measured
+ * with this resolution (10 us at 180 MHz). */
+#ifndef PERF_BENCH_PROBE_CYCLES
+#define PERF_BENCH_PROBE_CYCLES         (1800u)
+#endif
+
+/* Result lines: PERF,test,iterations,min_cycles,mean_cycles,max_cycles,
+ * bytes,irq_off_cycles,failures. tools/perf_compare.py reads them from the
+ * console log. */
+#define PERF_BENCH_TAG                  "PERF"
+
+/*******************************************************************************
+ * Data Types
+ *******************************************************************************/
+/* Cost of one slice function */
+typedef struct
+{
+    uint32_t iterations;        /* Slice calls measured */
+    uint32_t min_cycles;
+    uint32_t max_cycles;
+    uint64_t sum_cycles;
+    uint32_t bytes;             /* Bytes tested per slice, 0 if not a memory test */
+    uint32_t irq_off;           /* Longest interrupt-off window, in CPU cycles */
+    uint32_t failures;          /* Slice calls that returned an error */
+} perf_bench_result_t;
+
+/*******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+void Perf_Bench_Measure(test_slice_func_t func, uint32_t iterations, perf_bench_result_t *result);
+void Perf_Bench_Print(const char *name, const perf_bench_result_t *result);
+
+#endif /* PERF_BENCH_H_ */
+
+
+/* [] END OF FILE */
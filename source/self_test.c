@@ -42,7 +42,20 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include "self_test.h"
+#include "cycle_counter.h"
+#include "test_schedule.h"
+#include "test_schedule_cfg.h"
+#include "test_low_power.h"
+#include "ilo_trim.h"
+#include "clock_monitor.h"
+#include "clock_monitor_cfg.h"
+#include "cfg_snapshot.h"
+#include "cfg_snapshot_cfg.h"
+#include "ipc_bench.h"
+#include "fpu_slice_test.h"
+#include "perf_bench.h"
 
 /*******************************************************************************
  * Macros
@@ -68,8 +81,21 @@
 /* Waiting time, in milliseconds, for proper start-up of ILO */
 #define ILO_START_UP_TIME    (2U)
 
-/* 8 MHz IMO */
-#define IMO_FREQ 8000000UL
+/* The flash test covers the code flash up to the stored checksum, which sits
+ * right below the fault journal region. The journal itself is excluded as it
+ * is programmed at run time. */
+#define FLASH_CHECKSUM_SIZE  (8u)
+#define FLASH_TEST_END_ADDR  (FAULT_JOURNAL_BASE - FLASH_CHECKSUM_SIZE)
+
+/* The periodic test table must cover one complete flash and SRAM test run */
+typedef char test_schedule_flash_slices_check[(TEST_SCHEDULE_FLASH_SLICES ==
+    (((FLASH_TEST_END_ADDR - CY_FLASH_BASE) + ((8u * FLASH_DOUBLE_WORDS_TO_TEST) - 1u)) /
+     (8u * FLASH_DOUBLE_WORDS_TO_TEST))) ? 1 : -1];
+typedef char test_schedule_sram_slices_check[(TEST_SCHEDULE_SRAM_SLICES == (BLOCK_SIZE / BUFFER_SIZE)) ? 1 : -1];
+/* ... and the memory its slices cover */
+typedef char test_schedule_slice_bytes_check[((TEST_SCHEDULE_SRAM_SLICE_BYTES == BUFFER_SIZE) &&
+    (TEST_SCHEDULE_STACK_SLICE_BYTES == TEST_STACK_SIZE) &&
+    (TEST_SCHEDULE_FLASH_SLICE_BYTES == (8u * FLASH_DOUBLE_WORDS_TO_TEST))) ? 1 : -1];
 /*******************************************************************************
  * Global Variables
  *******************************************************************************/
@@ -98,9 +124,96 @@ CY_SECTION(".flash_checksum") uint64_t flash_StoredCheckSum = 0x6DB675C9EB90708E
 #endif
 
 
+/* Periodic tests: schedule, scheduler ticks counted and run, and next SRAM
+ * block to test */
+#if defined (TEST_SCHEDULE_CONST_TABLE)
+extern const test_schedule_plan_t test_schedule_table;
+#else
+static test_schedule_plan_t scheduled_plan;
+#endif
+static volatile uint32_t scheduled_tick_count = 0u;
+static uint32_t scheduled_tick_done = 0u;
+static uint32_t sram_slice_offset = 0u;
+static uint32_t ipc_slice_channel = 0u;
+
+/* Start-up configuration registers, see cfg_snapshot_cfg.h */
+#define CFG_SNAPSHOT_ENTRY(reg) &(reg),
+static const volatile uint32_t * const startup_cfg_regs[] =
+{
+    CFG_SNAPSHOT_REGS(CFG_SNAPSHOT_ENTRY)
+};
+static uint32_t startup_cfg_hash = 0u;
+static cfg_snapshot_ctx_t startup_cfg_check;
+#if (STARTUP_CFG_REGS_MODE == CFG_REGS_TO_FLASH_MODE)
+/* Program buffer of the snapshot record row */
+static uint32_t startup_cfg_row[FAULT_JOURNAL_ROW_SIZE / sizeof(uint32_t)];
+#endif
+
+/* Start-up test cost, see Start_Up_Test() */
+uint32_t startup_test_cycles = 0u;
+uint32_t startup_cfg_writes = 0u;
+bool startup_cfg_saved = false;
+
 /*******************************************************************************
  * Function Prototypes
  *******************************************************************************/
+static uint8_t Stack_March_Slice(void);
+static uint8_t SRAM_March_Slice(void);
+static uint8_t Stack_Check_Slice(void);
+static uint8_t Flash_Test_Slice(void);
+static void Flash_Test_Restart(void);
+static uint32_t Start_Up_Image_Id(void);
+static uint8_t Start_Up_Check_Slice(void);
+static uint8_t IPC_Test_Slice(void);
+static void Scheduled_Test_Report(uint8_t task, uint8_t status);
+static void Scheduled_Test_Restart(void);
+#if (TEST_LOW_POWER == 0u)
+static void Scheduled_Test_SysTick(void);
+#endif
+
+/* Periodic test table, see test_schedule_cfg.h */
+#define SCHEDULED_TASK_ENTRY(name, func, id, slices, cycles, period, irq_off, irq_limit, bytes) \
+        { (name), (func), (id), (slices), (cycles), (period), (irq_off), (irq_limit) },
+static const test_task_t scheduled_tasks[] =
+{
+    TEST_SCHEDULE_TASKS(SCHEDULED_TASK_ENTRY)
+};
+#define SCHEDULED_TASK_COUNT (sizeof(scheduled_tasks) / sizeof(scheduled_tasks[0]))
+
+#if (PERF_BENCH != 0u)
+/* Bytes per slice of the periodic tests, same order as scheduled_tasks */
+#define SCHEDULED_TASK_BYTES(name, func, id, slices, cycles, period, irq_off, irq_limit, bytes) (bytes),
+static const uint32_t scheduled_task_bytes[] =
+{
+    TEST_SCHEDULE_TASKS(SCHEDULED_TASK_BYTES)
+};
+#endif
+
+/* Background clock monitor, see clock_monitor_cfg.h */
+static bool Clock_Monitor_HwStart(const clock_monitor_source_t *source);
+static bool Clock_Monitor_HwDone(void);
+static uint32_t Clock_Monitor_HwGetFreq(const clock_monitor_source_t *source);
+static uint32_t Clock_Monitor_HwExpected(const clock_monitor_source_t *source);
+static void Clock_Monitor_HwAbort(const clock_monitor_source_t *source);
+static void Clock_Monitor_Report(uint8_t source, const clock_monitor_result_t *result);
+
+#define CLOCK_MONITOR_ENTRY(name, clock, tolerance, slow) \
+        { (name), (uint32_t)(clock), (tolerance), (slow) },
+static const clock_monitor_source_t clock_monitor_sources[] =
+{
+    CLOCK_MONITOR_SOURCES(CLOCK_MONITOR_ENTRY)
+};
+#define CLOCK_MONITOR_SOURCE_COUNT (sizeof(clock_monitor_sources) / sizeof(clock_monitor_sources[0]))
+
+static const clock_monitor_ops_t clock_monitor_ops =
+{
+    Clock_Monitor_HwStart,
+    Clock_Monitor_HwDone,
+    Clock_Monitor_HwGetFreq,
+    Clock_Monitor_HwExpected,
+    Cycle_Counter_Get,
+    Clock_Monitor_HwAbort
+};
 
  /*****************************************************************************
 * Function Name: IAR_Flash_Init
@@ -120,7 +233,7 @@ CY_SECTION(".flash_checksum") uint64_t flash_StoredCheckSum = 0x6DB675C9EB90708E
 #pragma optimize=none
 void IAR_Flash_Init()
 {
-    SelfTest_Flash_init(CY_FLASH_BASE,FLASH_END_ADDR,flash_StoredCheckSum);
+    SelfTest_Flash_init(CY_FLASH_BASE,FLASH_TEST_END_ADDR,flash_StoredCheckSum);
 }
 #endif
 /*****************************************************************************
@@ -137,11 +250,7 @@ void IAR_Flash_Init()
  *****************************************************************************/
 void Stack_March_Test(void)
 {
-    __disable_irq();
-
-    const uint8_t ret = SelfTest_SRAM_Stack((uint8_t *)DEVICE_STACK_BASE,(uint32_t)TEST_STACK_SIZE,(uint8_t *)ALT_STACK_BASE);
-    __enable_irq();
-
+    const uint8_t ret = Stack_March_Slice();
 
     /*Process error*/
     PRINT_TEST_RESULT(ip_index,"Stack March Test", ret);
@@ -221,6 +330,9 @@ void Stack_Memory_Test(void)
  ******************************************************************************
  * Summary:
  * Start Up Test : This function checks the startup configuration registers.
+ * In CFG_REGS_TO_FLASH_MODE, the registers are saved to flash only when the
+ * library's own compare finds that the saved copy is missing or differs,
+ * and are checked again after the save.
  *
  * Parameters:
  *  void
@@ -230,22 +342,61 @@ void Stack_Memory_Test(void)
  *****************************************************************************/
 void Start_Up_Test(void)
 {
+    const uint32_t start = Cycle_Counter_Get();
+    uint8_t ret;
+
+    /* Baseline of the periodic check, see Start_Up_Check_Slice() */
+    startup_cfg_hash = Cfg_Snapshot_Hash(startup_cfg_regs, (uint16_t)CFG_SNAPSHOT_REG_COUNT, Start_Up_Image_Id());
+    Cfg_Snapshot_Begin(&startup_cfg_check, startup_cfg_regs, (uint16_t)CFG_SNAPSHOT_REG_COUNT, Start_Up_Image_Id());
+
+    /**********************************/
+    /* Run Start-Up regs Self Test... */
+    /**********************************/
+    ret = SelfTests_StartUp_ConfigReg();
+
 #if (STARTUP_CFG_REGS_MODE == CFG_REGS_TO_FLASH_MODE)
+    const cfg_snapshot_record_t *stored = (const cfg_snapshot_record_t *)CFG_SNAPSHOT_RECORD_ADDR;
+
+    startup_cfg_writes = Cfg_Snapshot_IsValid(stored) ? stored->writes : 0u;
 
     /*******************************/
     /* Save Start-Up registers...  */
     /*******************************/
-    if (CY_FLASH_DRV_SUCCESS  != SelfTests_Save_StartUp_ConfigReg())
+    /* Only when the saved copy does not match the registers the library
+     * checks, for example after a new image, a changed clock configuration or
+     * a new ILO trim. The library compares its own register list, so the
+     * decision and the check cannot disagree. */
+    if (OK_STATUS != ret)
     {
-        /* Process error */
-        printf("Error: Can't save Start-Up Config Registers\r\n");
+        if (CY_FLASH_DRV_SUCCESS  != SelfTests_Save_StartUp_ConfigReg())
+        {
+            /* Process error */
+            Telemetry_Flush();
+            printf("Error: Can't save Start-Up Config Registers\r\n");
+        }
+        else
+        {
+            startup_cfg_writes++;
+            startup_cfg_saved = true;
+
+            (void)memset(startup_cfg_row, 0, sizeof(startup_cfg_row));
+            Cfg_Snapshot_MakeRecord((cfg_snapshot_record_t *)startup_cfg_row, CFG_SNAPSHOT_VERSION,
+                                    (uint16_t)CFG_SNAPSHOT_REG_COUNT, startup_cfg_hash, startup_cfg_writes);
+            if (CY_FLASH_DRV_SUCCESS != Cy_Flash_WriteRow(CFG_SNAPSHOT_RECORD_ADDR, startup_cfg_row))
+            {
+                /* Process error, only the write count is lost */
+                Telemetry_Flush();
+                printf("Error: Can't save Start-Up Config Register record\r\n");
+            }
+
+            /* Check against the new copy */
+            ret = SelfTests_StartUp_ConfigReg();
+        }
     }
 
 #endif /* End (STARTUP_CFG_REGS_MODE == CFG_REGS_TO_FLASH_MODE) */
-    /**********************************/
-    /* Run Start-Up regs Self Test... */
-    /**********************************/
-    const uint8_t ret = SelfTests_StartUp_ConfigReg();
+
+    startup_test_cycles = Cycle_Counter_Get() - start;
 
     /* Process error */
     PRINT_TEST_RESULT(ip_index++,"Start-Up Register Test",ret);
@@ -278,7 +429,8 @@ void Wdt_Test(void)
  ******************************************************************************
  * Summary:
  * FPU Test : The FPU registers test detects stuck-at faults in the FPU by
- * using the checkerboard test.
+ * using the checkerboard test. The start-up test is followed by one run of
+ * the sliced test that repeats in the background (fpu_slice_test.c).
  *
  * Parameters:
  *  void
@@ -291,8 +443,18 @@ void FPU_Test(void)
     /**********************************/
     /* Run FPU Registers Self Test... */
     /**********************************/
-    const uint8_t ret = SelfTest_FPU_Registers();
-    PRINT_TEST_RESULT(ip_index++,"FPU Register Test", ret);
+    uint8_t ret = SelfTest_FPU_Registers();
+
+    /* One run of the sliced test, which measures the slice costs */
+    if (ERROR_STATUS != ret)
+    {
+        Fpu_Slice_Restart();
+        do
+        {
+            ret = Fpu_Slice_Test();
+        } while (PASS_STILL_TESTING_STATUS == ret);
+    }
+    PRINT_TEST_RESULT_DETAIL(ip_index++,"FPU Register Test", ret, Fpu_Slice_GetDetail());
 
 }
 
@@ -360,14 +522,7 @@ void Clock_Test_Init(void)
     cy_en_tcpwm_status_t tcpwm_res;
     cy_en_sysint_status_t sysint_res;
 
-    /* Start the ILO clock measurement using the IMO- counter 1 clock - ILO counter 2 clock - IMO counter 1 period - 128*/
-    Cy_SysClk_StartClkMeasurementCounters(CY_SYSCLK_MEAS_CLK_ILO, 0x7FUL,CY_SYSCLK_MEAS_CLK_IMO);
-    /* Wait for counter 1 to reach 0 */
-    while(!Cy_SysClk_ClkMeasurementCountersDone()){}
-    /* Measure clock 1 with the IMO clock cycles (counter 2) */
-    uint32_t measuredFreq = Cy_SysClk_ClkMeasurementCountersGetFreq(false, IMO_FREQ);
-    /* Attempt to trim the ILO by 1 iteration step */
-    Cy_SysClk_IloTrim(measuredFreq);
+    /* The ILO trim is applied at start-up by Ilo_Trim_Init() */
 
     /* Unlock WDT */
     Cy_WDT_Unlock();
@@ -441,12 +596,22 @@ void Clock_Test(void)
 {
     uint8_t ret = 0u;
 
+    Test_LowPower_WindowBegin();
     Clock_Test_Init();
 
+    /* The other clock sources are measured while the time slot check runs */
+    Clock_Monitor_Start(clock_monitor_sources, (uint8_t)CLOCK_MONITOR_SOURCE_COUNT, &clock_monitor_ops,
+                        Clock_Monitor_Report);
+
     for (;;)
     {
+        Clock_Monitor_Poll();
         ret = SelfTest_Clock(CYBSP_CLOCK_TEST_TIMER_HW, CYBSP_CLOCK_TEST_TIMER_NUM);
         PRINT_TEST_RESULT(ip_index,"Clock Test", ret);
+        if (ERROR_STATUS == ret) {
+            /* The ILO may have drifted, re-measure its trim in the background */
+            Ilo_Trim_RequestRecal();
+        }
         if (PASS_STILL_TESTING_STATUS != ret) {
             break;
         }
@@ -462,9 +627,206 @@ void Clock_Test(void)
     Cy_WDT_ClearInterrupt();
     Cy_WDT_Unlock();
     Cy_WDT_Disable();
+    Test_LowPower_WindowEnd();
     ip_index++;
 }
 
+/*****************************************************************************
+ * Function Name: Clock_Monitor_HwStart
+ ******************************************************************************
+ * Summary:
+ * Starts the measurement of a clock source against the IMO. A fast clock is
+ * counted during CLOCK_MONITOR_REF_COUNT IMO cycles, a slow clock defines the
+ * window itself and the IMO cycles are counted.
+ *
+ * Parameters:
+ *  source : Clock source
+ *
+ * Return:
+ *  bool : false if the measurement counters are in use
+ *****************************************************************************/
+static bool Clock_Monitor_HwStart(const clock_monitor_source_t *source)
+{
+    cy_en_sysclk_status_t status;
+
+    /* The ILO trim manager holds the counters during its measurement */
+    if (Ilo_Trim_IsBusy())
+    {
+        return false;
+    }
+
+    if (source->slow)
+    {
+        status = Cy_SysClk_StartClkMeasurementCounters((cy_en_meas_clks_t)source->clock, CLOCK_MONITOR_SLOW_COUNT,
+                                                       CY_SYSCLK_MEAS_CLK_IMO);
+    }
+    else
+    {
+        status = Cy_SysClk_StartClkMeasurementCounters(CY_SYSCLK_MEAS_CLK_IMO, CLOCK_MONITOR_REF_COUNT,
+                                                       (cy_en_meas_clks_t)source->clock);
+    }
+
+    if (CY_SYSCLK_SUCCESS != status)
+    {
+        return false;
+    }
+
+    /* The measured clocks stop in Deep Sleep */
+    Test_LowPower_WindowBegin();
+    return true;
+}
+
+/*****************************************************************************
+ * Function Name: Clock_Monitor_HwDone
+ ******************************************************************************
+ * Summary:
+ * Checks whether the measurement completed.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  bool : true if the measurement completed
+ *****************************************************************************/
+static bool Clock_Monitor_HwDone(void)
+{
+    return Cy_SysClk_ClkMeasurementCountersDone();
+}
+
+/*****************************************************************************
+ * Function Name: Clock_Monitor_HwGetFreq
+ ******************************************************************************
+ * Summary:
+ * Returns the frequency of a completed measurement.
+ *
+ * Parameters:
+ *  source : Clock source
+ *
+ * Return:
+ *  uint32_t : Measured frequency in Hz
+ *****************************************************************************/
+static uint32_t Clock_Monitor_HwGetFreq(const clock_monitor_source_t *source)
+{
+    Test_LowPower_WindowEnd();
+
+    /* Fast clocks are counted by counter 2, slow clocks by counter 1 */
+    return Cy_SysClk_ClkMeasurementCountersGetFreq(!source->slow, CLOCK_MONITOR_REF_HZ);
+}
+
+/*****************************************************************************
+ * Function Name: Clock_Monitor_HwExpected
+ ******************************************************************************
+ * Summary:
+ * Returns the configured frequency of a clock source.
+ *
+ * Parameters:
+ *  source : Clock source
+ *
+ * Return:
+ *  uint32_t : Frequency in Hz, 0 if the source is not active
+ *****************************************************************************/
+static uint32_t Clock_Monitor_HwExpected(const clock_monitor_source_t *source)
+{
+    uint32_t freq = 0u;
+
+    if ((uint32_t)CY_SYSCLK_MEAS_CLK_ILO == source->clock)
+    {
+        freq = CY_SYSCLK_ILO_FREQ;
+    }
+    else if ((uint32_t)CY_SYSCLK_MEAS_CLK_ECO == source->clock)
+    {
+        freq = CLOCK_MONITOR_ECO_HZ;
+    }
+    else if (source->clock >= (uint32_t)CY_SYSCLK_MEAS_CLK_CLK_HFS)
+    {
+        const uint32_t root = source->clock - (uint32_t)CY_SYSCLK_MEAS_CLK_CLK_HFS;
+
+        if ((root < CY_SRSS_NUM_HFROOT) && Cy_SysClk_ClkHfIsEnabled(root))
+        {
+            freq = Cy_SysClk_ClkHfGetFrequency(root);
+        }
+    }
+    else if (source->clock >= (uint32_t)CY_SYSCLK_MEAS_CLK_PATH_CLKS)
+    {
+        const uint32_t path = source->clock - (uint32_t)CY_SYSCLK_MEAS_CLK_PATH_CLKS;
+
+        if (path < CY_SRSS_NUM_CLKPATH)
+        {
+            freq = Cy_SysClk_ClkPathGetFrequency(path);
+        }
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    return freq;
+}
+
+/*****************************************************************************
+ * Function Name: Clock_Monitor_HwAbort
+ ******************************************************************************
+ * Summary:
+ * Gives up a measurement that did not complete. The counters are left
+ * counting; the next start programs them again, as
+ * Cy_SysClk_StartClkMeasurementCounters() writes counter 1 whether or not
+ * the previous count completed. The only time it refuses is between the
+ * Deep Sleep check and the wake-up, which the low-power window closed here
+ * no longer blocks; the monitor then retries and fails the source if the
+ * refusals persist, see Clock_Monitor_Poll().
+ *
+ * Parameters:
+ *  source : Clock source
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+static void Clock_Monitor_HwAbort(const clock_monitor_source_t *source)
+{
+    (void)source;
+
+    Test_LowPower_WindowEnd();
+}
+
+/*****************************************************************************
+ * Function Name: Clock_Monitor_Report
+ ******************************************************************************
+ * Summary:
+ * Reports the clock monitor results. Failures are always reported, passes
+ * only in binary telemetry mode. An ILO deviation above
+ * CLOCK_MONITOR_ILO_RECAL_PPM requests a new ILO trim; a stopped ILO (timed
+ * out measurement) does not, as the trim measurement would never complete.
+ *
+ * Parameters:
+ *  source : Index into clock_monitor_sources
+ *  result : Result of the measurement
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+static void Clock_Monitor_Report(uint8_t source, const clock_monitor_result_t *result)
+{
+    if (((uint32_t)CY_SYSCLK_MEAS_CLK_ILO == clock_monitor_sources[source].clock) && (0u != result->measured) &&
+        ((result->error_ppm > (int32_t)CLOCK_MONITOR_ILO_RECAL_PPM) ||
+         (result->error_ppm < -(int32_t)CLOCK_MONITOR_ILO_RECAL_PPM)))
+    {
+        Ilo_Trim_RequestRecal();
+    }
+
+    if ((uint8_t)CLOCK_MONITOR_FAIL == result->state)
+    {
+        PRINT_TEST_RESULT_DETAIL(CLOCK_MONITOR_TEST_ID + source, clock_monitor_sources[source].name,
+                                 ERROR_STATUS, result->measured);
+    }
+#if (TELEMETRY_MODE == TELEMETRY_BINARY)
+    else
+    {
+        PRINT_TEST_RESULT_DETAIL(CLOCK_MONITOR_TEST_ID + source, clock_monitor_sources[source].name,
+                                 OK_STATUS, result->measured);
+    }
+#endif
+}
+
 /*****************************************************************************
  * Function Name: Interrupt_Test
  ******************************************************************************
@@ -480,9 +842,11 @@ void Clock_Test(void)
  *****************************************************************************/
 void Interrupt_Test(void)
 {
+    Test_LowPower_WindowBegin();
     Interrupt_Test_Init();
 
     const uint8_t ret = SelfTest_Interrupt(CYBSP_TIMER_HW, CYBSP_TIMER_NUM);
+    Test_LowPower_WindowEnd();
     PRINT_TEST_RESULT(ip_index++,"Interrupt Test", ret);
 
 }
@@ -551,18 +915,18 @@ void Flash_Test(void)
     uint8_t ret = 0u;
     /* Variable for output calculated Flash Checksum */
     uint8_t flash_CheckSum_temp;
-#if defined (__ICCARM__)
-    IAR_Flash_Init();
-#else
-    SelfTest_Flash_init(CY_FLASH_BASE,FLASH_END_ADDR,flash_StoredCheckSum);
-#endif
+    Flash_Test_Restart();
     for(;;)
     {
         ret =  SelfTest_FlashCheckSum(FLASH_DOUBLE_WORDS_TO_TEST);
-        PRINT_TEST_RESULT(ip_index,"Flash Test", ret);
+        PRINT_TEST_RESULT_DETAIL(ip_index,"Flash Test", ret, (uint32_t)flash_CheckSum);
 
         if (ERROR_STATUS == ret)
         {
+#if (TELEMETRY_MODE == TELEMETRY_BINARY)
+            /* The calculated checksum is part of the result record */
+            break;
+#endif
 #if(FLASH_TEST_MODE == FLASH_TEST_CRC32)
             printf("\r\nFLASH CRC: 0x");
 #elif (FLASH_TEST_MODE == FLASH_TEST_FLETCHER64)
@@ -593,6 +957,401 @@ void Flash_Test(void)
     ip_index++;
 }
 
+/*****************************************************************************
+ * Function Name: Flash_Test_Restart
+ ******************************************************************************
+ * Summary:
+ * Restarts the flash checksum calculation from the start of the flash.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+static void Flash_Test_Restart(void)
+{
+#if defined (__ICCARM__)
+    IAR_Flash_Init();
+#else
+    SelfTest_Flash_init(CY_FLASH_BASE,FLASH_TEST_END_ADDR,flash_StoredCheckSum);
+#endif
+}
+
+/*****************************************************************************
+ * Function Name: Start_Up_Image_Id
+ ******************************************************************************
+ * Summary:
+ * Returns an identifier of the programmed image, hashed in front of the
+ * start-up registers so that a new image always saves a new snapshot.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint32_t : Folded stored flash checksum
+ *****************************************************************************/
+static uint32_t Start_Up_Image_Id(void)
+{
+    return (uint32_t)flash_StoredCheckSum ^ (uint32_t)(flash_StoredCheckSum >> 32u);
+}
+
+/*****************************************************************************
+ * Function Name: Start_Up_Check_Slice
+ ******************************************************************************
+ * Summary:
+ * Hashes the next CFG_SNAPSHOT_SLICE_REGS start-up configuration registers
+ * and, after the last one, compares the hash with the hash taken at boot.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint8_t : Self test status
+ *****************************************************************************/
+static uint8_t Start_Up_Check_Slice(void)
+{
+    bool match;
+
+    if (!Cfg_Snapshot_Step(&startup_cfg_check, CFG_SNAPSHOT_SLICE_REGS))
+    {
+        return PASS_STILL_TESTING_STATUS;
+    }
+
+    match = (startup_cfg_check.hash == startup_cfg_hash);
+    Cfg_Snapshot_Begin(&startup_cfg_check, startup_cfg_regs, (uint16_t)CFG_SNAPSHOT_REG_COUNT, Start_Up_Image_Id());
+
+    return match ? PASS_COMPLETE_STATUS : ERROR_STATUS;
+}
+
+/*****************************************************************************
+ * Function Name: IPC_Test_Slice
+ ******************************************************************************
+ * Summary:
+ * Runs the IPC self test in the first slice, the IPC benchmark on one
+ * benchmark channel per slice, and a message burst over all channels in the
+ * last slice.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint8_t : Self test status
+ *****************************************************************************/
+static uint8_t IPC_Test_Slice(void)
+{
+    uint8_t ret = OK_STATUS;
+
+    if (0u == ipc_slice_channel)
+    {
+        ret = SelfTest_IPC();
+    }
+    if (ERROR_STATUS == ret)
+    {
+        /* Do Nothing */
+    }
+    else if (ipc_slice_channel < IPC_BENCH_CHANNEL_COUNT)
+    {
+        ret = Ipc_Bench_Channel(ipc_slice_channel, IPC_BENCH_SLICE_ITERATIONS);
+    }
+    else
+    {
+        ret = Ipc_Bench_Burst();
+    }
+
+    ipc_slice_channel++;
+    if ((ERROR_STATUS == ret) || (ipc_slice_channel >= IPC_BENCH_SLICE_COUNT))
+    {
+        ipc_slice_channel = 0u;
+        return (ERROR_STATUS == ret) ? ERROR_STATUS : PASS_COMPLETE_STATUS;
+    }
+
+    return PASS_STILL_TESTING_STATUS;
+}
+
+/*****************************************************************************
+ * Function Name: Stack_March_Slice
+ ******************************************************************************
+ * Summary:
+ * Runs the stack March test with interrupts disabled.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint8_t : Self test status
+ *****************************************************************************/
+static uint8_t Stack_March_Slice(void)
+{
+    __disable_irq();
+
+    const uint8_t ret = SelfTest_SRAM_Stack((uint8_t *)DEVICE_STACK_BASE,(uint32_t)TEST_STACK_SIZE,(uint8_t *)ALT_STACK_BASE);
+    __enable_irq();
+
+    return ret;
+}
+
+/*****************************************************************************
+ * Function Name: SRAM_March_Slice
+ ******************************************************************************
+ * Summary:
+ * Tests the next BUFFER_SIZE bytes of the SRAM test block, so that one
+ * complete run of the SRAM test takes BLOCK_SIZE / BUFFER_SIZE slices.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint8_t : PASS_STILL_TESTING_STATUS, PASS_COMPLETE_STATUS after the last
+ *  block, or the error status
+ *****************************************************************************/
+static uint8_t SRAM_March_Slice(void)
+{
+    __disable_irq();
+
+    uint8_t ret = SelfTest_SRAM(TEST_MODE,(uint8_t *)(DEVICE_SRAM_BASE + sram_slice_offset),BUFFER_SIZE,(uint8_t *)sram_restore_buff,BUFFER_SIZE);
+
+    __enable_irq();
+
+    if (OK_STATUS == ret)
+    {
+        sram_slice_offset = (sram_slice_offset + BUFFER_SIZE) % BLOCK_SIZE;
+        ret = (0u == sram_slice_offset) ? PASS_COMPLETE_STATUS : PASS_STILL_TESTING_STATUS;
+    }
+
+    return ret;
+}
+
+/*****************************************************************************
+ * Function Name: Stack_Check_Slice
+ ******************************************************************************
+ * Summary:
+ * Checks the stack overflow and underflow patterns written by
+ * Stack_Memory_Test().
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint8_t : Self test status
+ *****************************************************************************/
+static uint8_t Stack_Check_Slice(void)
+{
+    const uint8_t ret = SelfTests_Stack_Check_Range((uint16_t*)DEVICE_STACK_BASE, DEVICE_STACK_SIZE);
+
+    return (0u != (ret & (ERROR_STACK_OVERFLOW | ERROR_STACK_UNDERFLOW))) ? ERROR_STATUS : OK_STATUS;
+}
+
+/*****************************************************************************
+ * Function Name: Flash_Test_Slice
+ ******************************************************************************
+ * Summary:
+ * Calculates the flash checksum over the next FLASH_DOUBLE_WORDS_TO_TEST
+ * double words, and restarts from the start of the flash after a complete
+ * run.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint8_t : Self test status
+ *****************************************************************************/
+static uint8_t Flash_Test_Slice(void)
+{
+    const uint8_t ret = SelfTest_FlashCheckSum(FLASH_DOUBLE_WORDS_TO_TEST);
+
+    if (PASS_STILL_TESTING_STATUS != ret)
+    {
+        Flash_Test_Restart();
+    }
+
+    return ret;
+}
+
+/*****************************************************************************
+ * Function Name: Scheduled_Test_Report
+ ******************************************************************************
+ * Summary:
+ * Reports the periodic test results. Failures are always reported, completed
+ * runs only in binary telemetry mode.
+ *
+ * Parameters:
+ *  task   : Index into the periodic test table
+ *  status : Self test status of the slice
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+static void Scheduled_Test_Report(uint8_t task, uint8_t status)
+{
+    if ((OK_STATUS != status) && (PASS_COMPLETE_STATUS != status) && (PASS_STILL_TESTING_STATUS != status))
+    {
+        PRINT_TEST_RESULT(scheduled_tasks[task].test_id, scheduled_tasks[task].name, status);
+    }
+#if (TELEMETRY_MODE == TELEMETRY_BINARY)
+    else if (PASS_STILL_TESTING_STATUS != status)
+    {
+        PRINT_TEST_RESULT(scheduled_tasks[task].test_id, scheduled_tasks[task].name, status);
+    }
+#endif
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+#if (TEST_LOW_POWER == 0u)
+/*****************************************************************************
+ * Function Name: Scheduled_Test_SysTick
+ ******************************************************************************
+ * Summary:
+ * SysTick callback, counts a scheduler tick.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+static void Scheduled_Test_SysTick(void)
+{
+    scheduled_tick_count++;
+}
+#endif
+
+/*****************************************************************************
+ * Function Name: Scheduled_Test_Restart
+ ******************************************************************************
+ * Summary:
+ * Starts every sliced periodic test with its first slice.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+static void Scheduled_Test_Restart(void)
+{
+    Flash_Test_Restart();
+    sram_slice_offset = 0u;
+    ipc_slice_channel = 0u;
+    Fpu_Slice_Restart();
+    Cfg_Snapshot_Begin(&startup_cfg_check, startup_cfg_regs, (uint16_t)CFG_SNAPSHOT_REG_COUNT, Start_Up_Image_Id());
+}
+
+#if (PERF_BENCH != 0u)
+/*****************************************************************************
+ * Function Name: Scheduled_Test_Bench
+ ******************************************************************************
+ * Summary:
+ * Measures every slice function of the periodic test table with
+ * Perf_Bench_Measure() and prints one result line per test. A test whose
+ * slices take longer than the cycles or interrupt-off time in
+ * test_schedule_cfg.h is reported, as the schedule is then not valid. Uses
+ * the SysTick, so call it before Scheduled_Test_Init().
+ *
+ * Parameters:
+ *  iterations : Slice calls per test
+ *
+ * Return:
+ *  bool : false if a slice failed or exceeded its entry in the table
+ *****************************************************************************/
+bool Scheduled_Test_Bench(uint32_t iterations)
+{
+    perf_bench_result_t result;
+    bool passed = true;
+
+    Scheduled_Test_Restart();
+    for (uint32_t i = 0u; i < SCHEDULED_TASK_COUNT; i++)
+    {
+        const test_task_t *task = &scheduled_tasks[i];
+
+        Perf_Bench_Measure(task->slice, iterations, &result);
+        result.bytes = scheduled_task_bytes[i];
+        Perf_Bench_Print(task->name, &result);
+
+        if ((0u != result.failures) || (result.max_cycles > task->slice_cycles) ||
+            (result.irq_off > (task->irq_off_cycles + PERF_BENCH_PROBE_CYCLES)))
+        {
+            Telemetry_Flush();
+            printf("Error: %s exceeds its periodic test table entry\r\n", task->name);
+            passed = false;
+        }
+    }
+    Scheduled_Test_Restart();
+
+    return passed;
+}
+#endif
+
+/*****************************************************************************
+ * Function Name: Scheduled_Test_Init
+ ******************************************************************************
+ * Summary:
+ * Plans the periodic tests of test_schedule_cfg.h and starts the SysTick
+ * based scheduler tick. With TEST_LOW_POWER the ticks are counted by
+ * Test_LowPower_Run() instead. Call after the start-up test sequence.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  bool : false if the constraints of the periodic tests cannot be met
+ *****************************************************************************/
+bool Scheduled_Test_Init(void)
+{
+#if defined (TEST_SCHEDULE_CONST_TABLE)
+    /* Schedule generated by tools/schedule_planner */
+    const test_schedule_plan_t *plan = &test_schedule_table;
+#else
+    const test_schedule_plan_t *plan = &scheduled_plan;
+    const test_schedule_status_t status = Test_Schedule_Plan(scheduled_tasks, (uint8_t)SCHEDULED_TASK_COUNT,
+                                                             TEST_SCHEDULE_TICK_BUDGET, &scheduled_plan);
+
+    if (TEST_SCHEDULE_OK != status)
+    {
+        Telemetry_Flush();
+        printf("Error: Periodic test schedule not feasible (%d, %s)\r\n",
+               (int)status, scheduled_tasks[scheduled_plan.failed_task].name);
+        return false;
+    }
+#endif
+
+    Scheduled_Test_Restart();
+    Test_Schedule_Start(scheduled_tasks, plan, Scheduled_Test_Report);
+
+#if (TEST_LOW_POWER == 0u)
+    Cy_SysTick_Init(CY_SYSTICK_CLOCK_SOURCE_CLK_CPU, ((SystemCoreClock / 1000u) * TEST_SCHEDULE_TICK_MS) - 1u);
+    Cy_SysTick_SetCallback(0u, Scheduled_Test_SysTick);
+#endif
+
+    return true;
+}
+
+/*****************************************************************************
+ * Function Name: Scheduled_Test_Run
+ ******************************************************************************
+ * Summary:
+ * Runs the slices of all pending scheduler ticks. Call from the idle loop.
+ * Ticks that passed while the idle loop was blocked are caught up, so no
+ * slice is skipped.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+void Scheduled_Test_Run(void)
+{
+    /* Only the SysTick handler writes the count, only this loop the runs */
+    while (scheduled_tick_done != scheduled_tick_count)
+    {
+        scheduled_tick_done++;
+        Test_Schedule_Tick();
+    }
+}
 
 
 /* [] END OF FILE */
@@ -46,7 +46,10 @@
 #ifndef SELF_TEST_H_
 #define SELF_TEST_H_
 
+#include <stdbool.h>
 #include "SelfTest.h"
+#include "fault_journal.h"
+#include "telemetry.h"
 
 /*******************************************************************************
  * Global Variables
@@ -54,32 +57,59 @@
 extern uint16_t test_counter;
 /*Index for IPs*/
 extern uint8_t ip_index;
+/* CPU cycles of Start_Up_Test(), start-up register snapshot writes over all
+ * boots and whether this boot saved a new snapshot */
+extern uint32_t startup_test_cycles;
+extern uint32_t startup_cfg_writes;
+extern bool startup_cfg_saved;
 /*******************************************************************************
  * Macros
  *******************************************************************************/
 /* Error Message */
-/* Print Test Result*/
+/* Print Test Result, failures are also logged to the fault journal */
 #define PRINT_TEST_RESULT(index, test_name, ret) \
+        PRINT_TEST_RESULT_DETAIL(index, test_name, ret, 0u)
+
+#if (TELEMETRY_MODE == TELEMETRY_BINARY)
+/* Send Test Result as a binary telemetry record, every call (including each
+ * iteration of the sliced tests) produces one record */
+#define PRINT_TEST_RESULT_DETAIL(index, test_name, ret, detail) \
+        do { \
+            const uint8_t test_index_ = (uint8_t)(index); \
+            (void)(test_name); \
+            if ((OK_STATUS != ret) && (PASS_COMPLETE_STATUS != ret) && (PASS_STILL_TESTING_STATUS != ret)) { \
+                /* Process error */ \
+                Fault_Journal_Log(test_index_, ret, (detail)); \
+            } \
+            Telemetry_Result(test_index_, ret, test_counter, (detail)); \
+        } while (0)
+#else
+/* Print Test Result with test specific detail (checksum, address) for the
+ * fault journal */
+#define PRINT_TEST_RESULT_DETAIL(index, test_name, ret, detail) \
         do { \
+            const uint8_t test_index_ = (uint8_t)(index); \
             if (OK_STATUS == ret) { \
                 /* Process success */ \
-                printf("| %-4d| %-32s| %-12s|\r\n",index,test_name,"SUCCESS"); \
+                printf("| %-4d| %-32s| %-12s|\r\n",test_index_,test_name,"SUCCESS"); \
             } \
 else if (PASS_COMPLETE_STATUS == ret) { \
     /* Process status */ \
-    printf("| %-4d| %-32s| %-12s|\r\n",index,test_name,"SUCCESS"); \
+    printf("| %-4d| %-32s| %-12s|\r\n",test_index_,test_name,"SUCCESS"); \
     break; \
 } \
 else if (PASS_STILL_TESTING_STATUS == ret) { \
     /* Print test counter */ \
-    printf("| %-4d| %-32s| %-12s|count=%d\r",index,test_name,"IN PROGRESS", test_counter); \
+    printf("| %-4d| %-32s| %-12s|count=%d\r",test_index_,test_name,"IN PROGRESS", test_counter); \
 } \
 else { \
     /* Process error */ \
-    printf("| %-4d| %-32s| %-12s|\t\t",index,test_name,"ERROR"); \
+    Fault_Journal_Log(test_index_, ret, (detail)); \
+    printf("| %-4d| %-32s| %-12s|\t\t",test_index_,test_name,"ERROR"); \
     printf("\r\n"); \
 } \
 } while (0)
+#endif /* TELEMETRY_MODE == TELEMETRY_BINARY */
 
 /*******************************************************************************
 * Function Prototypes
@@ -97,6 +127,9 @@ void Start_Up_Test(void);
 void Stack_March_Test(void);
 void SRAM_March_Test(void);
 void Stack_Memory_Test(void);
+bool Scheduled_Test_Init(void);
+void Scheduled_Test_Run(void);
+bool Scheduled_Test_Bench(uint32_t iterations);
 
 #if defined (__ICCARM__)
 void IAR_Flash_Init();
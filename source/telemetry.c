@@ -0,0 +1,374 @@
+/******************************************************************************
+ * File Name:   telemetry.c
+ *
+ * Description: This file implements the binary telemetry stream on the debug
+ * UART. Every record is a COBS encoded frame with a CRC-16, delimited by
+ * 0x00 bytes, and is queued in a ring buffer that is drained into the UART
+ * FIFO without blocking. Use tools/telemetry_decode.py to decode the stream.
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+#include <string.h>
+#include "cy_pdl.h"
+#include "cybsp.h"
+#include "telemetry.h"
+#include "cycle_counter.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+/* Largest payload: header, test id, status, three 32-bit varints, CRC */
+#define TELEMETRY_MAX_PAYLOAD           (4u + (3u * 5u) + 2u)
+/* COBS adds one byte per 254 bytes plus one, and the two delimiters */
+#define TELEMETRY_MAX_FRAME             (TELEMETRY_MAX_PAYLOAD + 3u)
+
+#define TELEMETRY_SEQ_MASK              (0x1Fu)
+#define TELEMETRY_TYPE_POS              (5u)
+
+#define TELEMETRY_CRC16_INIT            (0xFFFFu)
+#define TELEMETRY_CRC16_POLY            (0x1021u)
+
+/*******************************************************************************
+ * Global Variables
+ *******************************************************************************/
+static uint8_t telemetry_buffer[TELEMETRY_BUFFER_SIZE];
+static volatile uint32_t telemetry_head = 0u;
+static volatile uint32_t telemetry_tail = 0u;
+
+static uint8_t telemetry_seq = 0u;
+static uint32_t telemetry_stalls = 0u;
+static uint32_t telemetry_stalls_sent = 0u;
+static uint32_t telemetry_last_cycles = 0u;
+
+/*******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+static uint16_t Telemetry_Crc16(const uint8_t *data, uint32_t length);
+static uint32_t Telemetry_PutVarint(uint8_t *dst, uint32_t value);
+static void Telemetry_Send(uint8_t *payload, uint32_t length);
+
+/*******************************************************************************
+ * Function Definitions
+ *******************************************************************************/
+
+/*****************************************************************************
+ * Function Name: Telemetry_Crc16
+ ******************************************************************************
+ * Summary:
+ * Calculates the CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) of a buffer.
+ *
+ * Parameters:
+ *  data   : Pointer to the data
+ *  length : Number of bytes
+ *
+ * Return:
+ *  uint16_t : CRC of the data
+ *****************************************************************************/
+static uint16_t Telemetry_Crc16(const uint8_t *data, uint32_t length)
+{
+    uint16_t crc = TELEMETRY_CRC16_INIT;
+
+    for (uint32_t i = 0u; i < length; i++)
+    {
+        crc ^= (uint16_t)((uint16_t)data[i] << 8u);
+        for (uint32_t bit = 0u; bit < 8u; bit++)
+        {
+            crc = (0u != (crc & 0x8000u)) ? (uint16_t)((crc << 1u) ^ TELEMETRY_CRC16_POLY) : (uint16_t)(crc << 1u);
+        }
+    }
+
+    return crc;
+}
+
+/*****************************************************************************
+ * Function Name: Telemetry_PutVarint
+ ******************************************************************************
+ * Summary:
+ * Writes a value as an unsigned LEB128 varint (7 bits per byte, MSB set on
+ * all but the last byte). Small values take one byte.
+ *
+ * Parameters:
+ *  dst   : Destination buffer, at least 5 bytes
+ *  value : Value to write
+ *
+ * Return:
+ *  uint32_t : Number of bytes written
+ *****************************************************************************/
+static uint32_t Telemetry_PutVarint(uint8_t *dst, uint32_t value)
+{
+    uint32_t length = 0u;
+
+    while (value >= 0x80u)
+    {
+        dst[length++] = (uint8_t)(value | 0x80u);
+        value >>= 7u;
+    }
+    dst[length++] = (uint8_t)value;
+
+    return length;
+}
+
+/*****************************************************************************
+ * Function Name: Telemetry_Send
+ ******************************************************************************
+ * Summary:
+ * Appends the CRC to the payload, COBS encodes it and queues the frame. If
+ * the ring buffer has no room for it, the frame waits until the UART has
+ * taken enough bytes, so no record is lost; these waits are counted.
+ *
+ * Parameters:
+ *  payload : Payload buffer with two spare bytes at the end for the CRC
+ *  length  : Payload length without the CRC
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+static void Telemetry_Send(uint8_t *payload, uint32_t length)
+{
+    uint8_t frame[TELEMETRY_MAX_FRAME];
+    uint32_t frame_len = 1u;
+    uint32_t code_index;
+    uint8_t code = 1u;
+    uint16_t crc = Telemetry_Crc16(payload, length);
+    uint32_t intr_status;
+
+    payload[length++] = (uint8_t)crc;
+    payload[length++] = (uint8_t)(crc >> 8u);
+
+    /* Leading delimiter separates the frame from any text printed before */
+    frame[0] = 0u;
+    code_index = frame_len++;
+    for (uint32_t i = 0u; i < length; i++)
+    {
+        if (0u == payload[i])
+        {
+            frame[code_index] = code;
+            code = 1u;
+            code_index = frame_len++;
+        }
+        else
+        {
+            frame[frame_len++] = payload[i];
+            code++;
+        }
+    }
+    frame[code_index] = code;
+    frame[frame_len++] = 0u;
+
+    intr_status = Cy_SysLib_EnterCriticalSection();
+    if ((TELEMETRY_BUFFER_SIZE - (telemetry_head - telemetry_tail)) < frame_len)
+    {
+        telemetry_stalls++;
+        while ((TELEMETRY_BUFFER_SIZE - (telemetry_head - telemetry_tail)) < frame_len)
+        {
+            /* Telemetry_Poll() works on the TX FIFO directly, so this also
+             * drains the ring with interrupts disabled */
+            Telemetry_Poll();
+        }
+    }
+    for (uint32_t i = 0u; i < frame_len; i++)
+    {
+        telemetry_buffer[(telemetry_head + i) & (TELEMETRY_BUFFER_SIZE - 1u)] = frame[i];
+    }
+    telemetry_head += frame_len;
+    Cy_SysLib_ExitCriticalSection(intr_status);
+
+    Telemetry_Poll();
+}
+
+/*****************************************************************************
+ * Function Name: Telemetry_Init
+ ******************************************************************************
+ * Summary:
+ * Resets the ring buffer and the per-record timing reference. The debug
+ * UART must already be initialized and enabled.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+void Telemetry_Init(void)
+{
+    telemetry_head = 0u;
+    telemetry_tail = 0u;
+    telemetry_seq = 0u;
+    telemetry_stalls = 0u;
+    telemetry_stalls_sent = 0u;
+    telemetry_last_cycles = Cycle_Counter_Get();
+}
+
+/*****************************************************************************
+ * Function Name: Telemetry_Result
+ ******************************************************************************
+ * Summary:
+ * Queues a test result record. The record carries the CPU cycles elapsed
+ * since the previous result record, which is the run time of the test (or
+ * test slice) as the tests run back to back.
+ *
+ * Parameters:
+ *  test_id   : Index of the test
+ *  status    : Self test return status
+ *  iteration : Iteration counter of sliced tests (test_counter)
+ *  detail    : Checksum, address or other test specific data
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+void Telemetry_Result(uint8_t test_id, uint8_t status, uint16_t iteration, uint32_t detail)
+{
+    uint8_t payload[TELEMETRY_MAX_PAYLOAD];
+    uint32_t length = 0u;
+    const uint32_t now = Cycle_Counter_Get();
+
+    payload[length++] = (uint8_t)((TELEMETRY_TYPE_RESULT << TELEMETRY_TYPE_POS) | (telemetry_seq++ & TELEMETRY_SEQ_MASK));
+    payload[length++] = test_id;
+    payload[length++] = status;
+    length += Telemetry_PutVarint(&payload[length], iteration);
+    length += Telemetry_PutVarint(&payload[length], now - telemetry_last_cycles);
+    length += Telemetry_PutVarint(&payload[length], detail);
+    telemetry_last_cycles = now;
+
+    Telemetry_Send(payload, length);
+}
+
+/*****************************************************************************
+ * Function Name: Telemetry_Counter
+ ******************************************************************************
+ * Summary:
+ * Queues a counter record.
+ *
+ * Parameters:
+ *  counter_id : One of the TELEMETRY_COUNTER_ identifiers
+ *  value      : Counter value
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+void Telemetry_Counter(uint8_t counter_id, uint32_t value)
+{
+    uint8_t payload[TELEMETRY_MAX_PAYLOAD];
+    uint32_t length = 0u;
+
+    payload[length++] = (uint8_t)((TELEMETRY_TYPE_COUNTER << TELEMETRY_TYPE_POS) | (telemetry_seq++ & TELEMETRY_SEQ_MASK));
+    payload[length++] = counter_id;
+    length += Telemetry_PutVarint(&payload[length], value);
+
+    Telemetry_Send(payload, length);
+}
+
+/*****************************************************************************
+ * Function Name: Telemetry_Poll
+ ******************************************************************************
+ * Summary:
+ * Moves as many queued bytes as fit into the debug UART TX FIFO. Does not
+ * block; call it from the idle loop to keep the stream flowing.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+void Telemetry_Poll(void)
+{
+    const uint32_t intr_status = Cy_SysLib_EnterCriticalSection();
+
+    while (telemetry_head != telemetry_tail)
+    {
+        const uint32_t offset = telemetry_tail & (TELEMETRY_BUFFER_SIZE - 1u);
+        uint32_t length = telemetry_head - telemetry_tail;
+        uint32_t written;
+
+        /* Contiguous part up to the end of the buffer */
+        if (length > (TELEMETRY_BUFFER_SIZE - offset))
+        {
+            length = TELEMETRY_BUFFER_SIZE - offset;
+        }
+
+        written = Cy_SCB_UART_PutArray(DEBUG_UART_HW, &telemetry_buffer[offset], length);
+        telemetry_tail += written;
+
+        if (written < length)
+        {
+            /* TX FIFO full */
+            break;
+        }
+    }
+
+    Cy_SysLib_ExitCriticalSection(intr_status);
+}
+
+/*****************************************************************************
+ * Function Name: Telemetry_Flush
+ ******************************************************************************
+ * Summary:
+ * Queues the stall counter if it changed since it was last sent and blocks
+ * until all queued frames are in the UART TX FIFO. Call it before printing
+ * text on the debug UART, so the text does not split a frame.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+void Telemetry_Flush(void)
+{
+    while (telemetry_head != telemetry_tail)
+    {
+        Telemetry_Poll();
+    }
+
+    /* Queued into the empty ring, so sending it does not stall again */
+    if (telemetry_stalls_sent != telemetry_stalls)
+    {
+        telemetry_stalls_sent = telemetry_stalls;
+        Telemetry_Counter(TELEMETRY_COUNTER_STALLS, telemetry_stalls);
+
+        while (telemetry_head != telemetry_tail)
+        {
+            Telemetry_Poll();
+        }
+    }
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,100 @@
+/******************************************************************************
+ * File Name:   telemetry.h
+ *
+ * Description: This file is the public interface of telemetry.c source file.
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+/*******************************************************************************
+ * Include guard
+ *******************************************************************************/
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+#include <stdint.h>
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+/* Debug UART output modes */
+#define TELEMETRY_TEXT                  (0u)    /* Human readable result table */
+#define TELEMETRY_BINARY                (1u)    /* COBS framed binary records */
+
+/* Output mode, can be overridden from the Makefile (DEFINES+=TELEMETRY_MODE=1) */
+#ifndef TELEMETRY_MODE
+#define TELEMETRY_MODE                  TELEMETRY_TEXT
+#endif
+
+/* Transmit ring buffer size in bytes, must be a power of two. The periodic
+ * tests send a record per completed run, a few per second, which the UART
+ * (about 11 bytes/ms at 115200 Bd) drains long before the ring fills. The
+ * ring takes the records of about 36 back to back iterations of the sliced
+ * start-up tests; beyond that, a record waits for room instead of being
+ * dropped. */
+#define TELEMETRY_BUFFER_SIZE           (512u)
+
+/* Record types (upper 3 bits of the first payload byte, the lower 5 bits
+ * carry a frame sequence number to detect lost frames) */
+#define TELEMETRY_TYPE_RESULT           (1u)
+#define TELEMETRY_TYPE_COUNTER          (2u)
+
+/* Counter identifiers of TELEMETRY_TYPE_COUNTER records */
+#define TELEMETRY_COUNTER_STALLS        (0u)    /* Frames that waited for room in the ring */
+#define TELEMETRY_COUNTER_JOURNAL_DROP  (1u)    /* Fault journal records lost */
+#define TELEMETRY_COUNTER_TESTS         (2u)    /* Number of tests run */
+#define TELEMETRY_COUNTER_WAKEUPS       (3u)    /* Deep Sleep exits */
+#define TELEMETRY_COUNTER_TEST_WAKEUPS  (4u)    /* Wake-ups caused by the test timer */
+#define TELEMETRY_COUNTER_SHARED_WAKEUPS (5u)   /* Application wake-ups the tests ran on */
+#define TELEMETRY_COUNTER_AWAKE_CYCLES  (6u)    /* CPU cycles spent in the periodic tests */
+#define TELEMETRY_COUNTER_STARTUP_CYCLES (7u)   /* CPU cycles of the start-up register test */
+#define TELEMETRY_COUNTER_SNAPSHOT_WRITES (8u)  /* Start-up register snapshot writes */
+
+/*******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+void Telemetry_Init(void);
+void Telemetry_Result(uint8_t test_id, uint8_t status, uint16_t iteration, uint32_t detail);
+void Telemetry_Counter(uint8_t counter_id, uint32_t value);
+void Telemetry_Poll(void);
+void Telemetry_Flush(void);
+
+#endif /* TELEMETRY_H_ */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,381 @@
+/******************************************************************************
+ * File Name:   test_low_power.c
+ *
+ * Description: This file runs the periodic self tests around Deep Sleep. The
+ * WDT counter, which keeps running on the ILO in Deep Sleep, is the time
+ * base of the test schedule. On every wake-up the slices of all elapsed
+ * ticks, and of the ticks due shortly, are run in one batch, and the WDT
+ * match is set to wake the CPU only for the next slice that cannot wait.
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+#include "cy_pdl.h"
+#include "cybsp.h"
+#include "test_low_power.h"
+#include "test_schedule.h"
+#include "test_schedule_cfg.h"
+#include "telemetry.h"
+#include "cycle_counter.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+/* WDT counts per scheduler tick and longest sleep */
+#define TEST_LOW_POWER_ILO_PER_TICK     (((CY_SYSCLK_ILO_FREQ * TEST_SCHEDULE_TICK_MS) + 500u) / 1000u)
+#define TEST_LOW_POWER_MAX_SLEEP        ((CY_SYSCLK_ILO_FREQ / 1000u) * TEST_LOW_POWER_MAX_SLEEP_MS)
+
+#define TEST_LOW_POWER_WDT_MASK         (0xFFFFu)
+#define TEST_LOW_POWER_WDT_PRIORITY     (3u)
+
+/*******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+static void Test_LowPower_WdtIsr(void);
+static cy_en_syspm_status_t Test_LowPower_Callback(cy_stc_syspm_callback_params_t *callbackParams,
+                                                   cy_en_syspm_callback_mode_t mode);
+
+/*******************************************************************************
+ * Global Variables
+ *******************************************************************************/
+static test_low_power_stats_t lp_stats;
+
+/* Number of open measurement windows, Deep Sleep is refused while open */
+static volatile uint32_t lp_windows = 0u;
+/* Set by the WDT match interrupt */
+static volatile bool lp_timer_fired = false;
+static bool lp_slept = false;
+
+static uint32_t lp_last_count = 0u;     /* WDT count at the last run */
+static uint32_t lp_counts = 0u;         /* WDT counts not yet turned into ticks */
+static uint32_t lp_ahead = 0u;          /* Ticks run ahead of time */
+
+static cy_stc_syspm_callback_params_t lp_callback_params = { NULL, NULL };
+static cy_stc_syspm_callback_t lp_callback =
+{
+    &Test_LowPower_Callback,    /* Callback function */
+    CY_SYSPM_DEEPSLEEP,         /* Callback type */
+    0u,                         /* Skip no mode */
+    &lp_callback_params,        /* Callback parameters */
+    NULL,                       /* Previous callback */
+    NULL,                       /* Next callback */
+    0u                          /* Callback order */
+};
+
+/*******************************************************************************
+ * Function Definitions
+ *******************************************************************************/
+
+/*****************************************************************************
+ * Function Name: Test_LowPower_WdtIsr
+ ******************************************************************************
+ * Summary:
+ * WDT match interrupt. Clearing it also keeps the WDT from resetting the
+ * device.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+static void Test_LowPower_WdtIsr(void)
+{
+    Cy_WDT_ClearInterrupt();
+    lp_timer_fired = true;
+}
+
+/*****************************************************************************
+ * Function Name: Test_LowPower_Callback
+ ******************************************************************************
+ * Summary:
+ * Deep Sleep callback. Refuses Deep Sleep while a measurement window is open
+ * (the clock and interrupt tests need the CPU clock and the TCPWM) or while
+ * the debug UART is still sending, and counts the wake-ups.
+ *
+ * Parameters:
+ *  callbackParams : Not used
+ *  mode           : Callback mode
+ *
+ * Return:
+ *  cy_en_syspm_status_t : CY_SYSPM_FAIL to refuse Deep Sleep
+ *****************************************************************************/
+static cy_en_syspm_status_t Test_LowPower_Callback(cy_stc_syspm_callback_params_t *callbackParams,
+                                                   cy_en_syspm_callback_mode_t mode)
+{
+    cy_en_syspm_status_t status = CY_SYSPM_SUCCESS;
+
+    (void)callbackParams;
+
+    switch (mode)
+    {
+        case CY_SYSPM_CHECK_READY:
+            if ((0u != lp_windows) || !Cy_SCB_UART_IsTxComplete(DEBUG_UART_HW))
+            {
+                lp_stats.sleep_refused++;
+                status = CY_SYSPM_FAIL;
+            }
+            break;
+
+        case CY_SYSPM_AFTER_TRANSITION:
+            lp_stats.wakeups++;
+            break;
+
+        default:
+            break;
+    }
+
+    return status;
+}
+
+/*****************************************************************************
+ * Function Name: Test_LowPower_Init
+ ******************************************************************************
+ * Summary:
+ * Starts the WDT as a free running Deep Sleep time base and registers the
+ * Deep Sleep callback that refuses Deep Sleep while a measurement window is
+ * open. Call after the start-up test sequence.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+void Test_LowPower_Init(void)
+{
+    cy_stc_sysint_t intrCfg =
+    {
+            /*.intrSrc =*/ srss_interrupt_IRQn,              /* WDT match interrupt */
+            /*.intrPriority =*/ TEST_LOW_POWER_WDT_PRIORITY
+    };
+
+    Cy_WDT_Unlock();
+    Cy_WDT_Disable();
+    Cy_WDT_SetIgnoreBits(0u);
+    Cy_WDT_ClearInterrupt();
+    Cy_WDT_UnmaskInterrupt();
+
+    if (CY_SYSINT_SUCCESS != Cy_SysInt_Init(&intrCfg, Test_LowPower_WdtIsr))
+    {
+        CY_ASSERT(0);
+    }
+    NVIC_EnableIRQ(intrCfg.intrSrc);
+
+    Cy_WDT_Enable();
+    lp_last_count = Cy_WDT_GetCount();
+
+    if (!Cy_SysPm_RegisterCallback(&lp_callback))
+    {
+        CY_ASSERT(0);
+    }
+}
+
+/*****************************************************************************
+ * Function Name: Test_LowPower_Run
+ ******************************************************************************
+ * Summary:
+ * Runs the slices of the ticks elapsed since the last call and of the ticks
+ * due within TEST_LOW_POWER_PULL_IN_TICKS, sets the WDT match to the next
+ * slice, and enters Deep Sleep (CPU Sleep if Deep Sleep is refused). Slices
+ * are never split by sleep, so a multi-slice test continues with its next
+ * slice after the wake-up. Call from the idle loop.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+void Test_LowPower_Run(void)
+{
+    const uint32_t start = Cycle_Counter_Get();
+    const uint32_t now = Cy_WDT_GetCount();
+    uint32_t ticks;
+    uint32_t gap;
+    uint32_t wake;
+    uint32_t wraps = 0u;
+    bool ran = false;
+
+    lp_counts += (now - lp_last_count) & TEST_LOW_POWER_WDT_MASK;
+    lp_last_count = now;
+    ticks = lp_counts / TEST_LOW_POWER_ILO_PER_TICK;
+    lp_counts -= ticks * TEST_LOW_POWER_ILO_PER_TICK;
+
+    /* Ticks already run ahead of time are paid back first */
+    if (ticks >= lp_ahead)
+    {
+        ticks -= lp_ahead;
+        lp_ahead = 0u;
+    }
+    else
+    {
+        lp_ahead -= ticks;
+        ticks = 0u;
+    }
+
+    if (0u != ticks)
+    {
+        wraps += Test_Schedule_Advance(ticks);
+        ran = true;
+    }
+
+    /* Awake anyway: batch the slices that are due soon */
+    gap = Test_Schedule_NextDue();
+    while ((lp_ahead + gap) < TEST_LOW_POWER_PULL_IN_TICKS)
+    {
+        wraps += Test_Schedule_Advance(gap + 1u);
+        lp_ahead += gap + 1u;
+        ran = true;
+        gap = Test_Schedule_NextDue();
+    }
+
+    if (lp_slept)
+    {
+        if (lp_timer_fired)
+        {
+            lp_stats.test_wakeups++;
+        }
+        else if (ran)
+        {
+            lp_stats.shared_wakeups++;
+        }
+        else
+        {
+            /* Application wake-up, no test due */
+        }
+    }
+    lp_timer_fired = false;
+    lp_stats.schedule_cycles += wraps;
+
+#if (TELEMETRY_MODE == TELEMETRY_BINARY)
+    if (0u != wraps)
+    {
+        Telemetry_Counter(TELEMETRY_COUNTER_WAKEUPS, lp_stats.wakeups);
+        Telemetry_Counter(TELEMETRY_COUNTER_TEST_WAKEUPS, lp_stats.test_wakeups);
+        Telemetry_Counter(TELEMETRY_COUNTER_SHARED_WAKEUPS, lp_stats.shared_wakeups);
+        Telemetry_Counter(TELEMETRY_COUNTER_AWAKE_CYCLES, lp_stats.awake_cycles);
+    }
+#endif
+
+    /* Wake up for the next slice that is not run ahead of time */
+    wake = ((lp_ahead + gap + 1u) * TEST_LOW_POWER_ILO_PER_TICK) - lp_counts;
+    if (wake > TEST_LOW_POWER_MAX_SLEEP)
+    {
+        wake = TEST_LOW_POWER_MAX_SLEEP;
+    }
+    Cy_WDT_SetMatch((now + wake) & TEST_LOW_POWER_WDT_MASK);
+
+    lp_stats.awake_cycles += Cycle_Counter_Get() - start;
+
+    /* Running the slices took longer than the sleep time, run again */
+    if (((Cy_WDT_GetCount() - now) & TEST_LOW_POWER_WDT_MASK) >= wake)
+    {
+        lp_slept = false;
+        return;
+    }
+
+    lp_slept = (CY_SYSPM_SUCCESS == Cy_SysPm_CpuEnterDeepSleep(CY_SYSPM_WAIT_FOR_INTERRUPT));
+    if (!lp_slept)
+    {
+        (void)Cy_SysPm_CpuEnterSleep(CY_SYSPM_WAIT_FOR_INTERRUPT);
+        lp_slept = true;
+    }
+}
+
+/*****************************************************************************
+ * Function Name: Test_LowPower_WindowBegin
+ ******************************************************************************
+ * Summary:
+ * Opens a measurement window. Deep Sleep is refused until the window is
+ * closed; CPU Sleep is still allowed as the timers keep running.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+void Test_LowPower_WindowBegin(void)
+{
+    const uint32_t intr_status = Cy_SysLib_EnterCriticalSection();
+    lp_windows++;
+    Cy_SysLib_ExitCriticalSection(intr_status);
+}
+
+/*****************************************************************************
+ * Function Name: Test_LowPower_WindowEnd
+ ******************************************************************************
+ * Summary:
+ * Closes a measurement window opened by Test_LowPower_WindowBegin().
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+void Test_LowPower_WindowEnd(void)
+{
+    const uint32_t intr_status = Cy_SysLib_EnterCriticalSection();
+    if (0u != lp_windows)
+    {
+        lp_windows--;
+    }
+    Cy_SysLib_ExitCriticalSection(intr_status);
+}
+
+/*****************************************************************************
+ * Function Name: Test_LowPower_GetStats
+ ******************************************************************************
+ * Summary:
+ * Returns the wake-up and awake time counters.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  const test_low_power_stats_t * : Counters
+ *****************************************************************************/
+const test_low_power_stats_t * Test_LowPower_GetStats(void)
+{
+    return &lp_stats;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,95 @@
+/******************************************************************************
+ * File Name:   test_low_power.h
+ *
+ * Description: This file is the public interface of test_low_power.c source file.
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+/*******************************************************************************
+ * Include guard
+ *******************************************************************************/
+#ifndef TEST_LOW_POWER_H_
+#define TEST_LOW_POWER_H_
+
+#include <stdint.h>
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+/* 1: the idle loop sleeps in Deep Sleep and runs the periodic tests on the
+ * wake-ups, 0: the periodic tests run on the SysTick tick and the CPU stays
+ * awake. Can be overridden from the Makefile (DEFINES+=TEST_LOW_POWER=1). */
+#ifndef TEST_LOW_POWER
+#define TEST_LOW_POWER                  (0u)
+#endif
+
+/* Slices due within this many ticks are run early on a wake-up caused by the
+ * application, instead of waking up again for them. The diagnostic interval
+ * of a test can grow by up to this many ticks. */
+#define TEST_LOW_POWER_PULL_IN_TICKS    (5u)
+
+/* Longest Deep Sleep, the 16-bit WDT counter wraps after 2 s */
+#define TEST_LOW_POWER_MAX_SLEEP_MS     (1500u)
+
+/*******************************************************************************
+ * Data Types
+ *******************************************************************************/
+typedef struct
+{
+    uint32_t wakeups;           /* Deep Sleep exits, for any reason */
+    uint32_t test_wakeups;      /* Wake-ups caused only by the test timer */
+    uint32_t shared_wakeups;    /* Application wake-ups the tests ran on */
+    uint32_t sleep_refused;     /* Deep Sleep requests refused by a running test */
+    uint32_t awake_cycles;      /* CPU cycles spent running the periodic tests */
+    uint32_t schedule_cycles;   /* Completed passes over the test schedule */
+} test_low_power_stats_t;
+
+/*******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+void Test_LowPower_Init(void);
+void Test_LowPower_Run(void);
+void Test_LowPower_WindowBegin(void);
+void Test_LowPower_WindowEnd(void);
+const test_low_power_stats_t * Test_LowPower_GetStats(void);
+
+#endif /* TEST_LOW_POWER_H_ */
+
+
+/* [] END OF FILE */
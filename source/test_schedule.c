@@ -0,0 +1,380 @@
+/******************************************************************************
+ * File Name:   test_schedule.c
+ *
+ * Description: This file implements the diagnostic test interval planner and
+ * the table driven periodic test runner. The file has no device
+ * dependencies, so the planner also builds on a host (tools/).
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+#include <stddef.h>
+#include <string.h>
+#include "test_schedule.h"
+
+/*******************************************************************************
+ * Global Variables
+ *******************************************************************************/
+/* Per tick load and slice placement used while planning */
+static uint32_t plan_load[TEST_SCHEDULE_MAX_TICKS];
+static uint16_t plan_slot_tick[TEST_SCHEDULE_MAX_ENTRIES];
+static uint8_t  plan_slot_task[TEST_SCHEDULE_MAX_ENTRIES];
+
+/* Runner state */
+static const test_task_t          *run_tasks = NULL;
+static const test_schedule_plan_t *run_plan = NULL;
+static test_schedule_report_t      run_report = NULL;
+static uint16_t                    run_tick = 0u;
+
+/*******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+static uint32_t Test_Schedule_Gcd(uint32_t a, uint32_t b);
+
+/*******************************************************************************
+ * Function Definitions
+ *******************************************************************************/
+
+/*****************************************************************************
+ * Function Name: Test_Schedule_Gcd
+ ******************************************************************************
+ * Summary:
+ * Greatest common divisor, used for the schedule length.
+ *
+ * Parameters:
+ *  a, b : Values
+ *
+ * Return:
+ *  uint32_t : gcd(a, b)
+ *****************************************************************************/
+static uint32_t Test_Schedule_Gcd(uint32_t a, uint32_t b)
+{
+    while (0u != b)
+    {
+        const uint32_t r = a % b;
+        a = b;
+        b = r;
+    }
+    return a;
+}
+
+/*****************************************************************************
+ * Function Name: Test_Schedule_Plan
+ ******************************************************************************
+ * Summary:
+ * Builds a static slice schedule. The schedule repeats every lcm(periods)
+ * ticks; each period window of a task gets all slices of one complete test
+ * run, so every test completes within its diagnostic interval. Tasks are
+ * placed in order of decreasing slice cost, and every slice goes to the least
+ * loaded tick of its window, which keeps the peak tick load low.
+ *
+ * Parameters:
+ *  tasks       : Task table
+ *  task_count  : Number of tasks
+ *  tick_budget : CPU cycles per tick the tests may use
+ *  plan        : Output schedule
+ *
+ * Return:
+ *  test_schedule_status_t : TEST_SCHEDULE_OK if all constraints are met,
+ *  otherwise the violated constraint (plan->failed_task names the task)
+ *****************************************************************************/
+test_schedule_status_t Test_Schedule_Plan(const test_task_t *tasks, uint8_t task_count,
+                                          uint32_t tick_budget, test_schedule_plan_t *plan)
+{
+    uint8_t order[TEST_SCHEDULE_MAX_TASKS];
+    uint32_t ticks = 1u;
+    uint32_t slots = 0u;
+
+    (void)memset(plan, 0, sizeof(*plan));
+
+    if ((0u == task_count) || (task_count > TEST_SCHEDULE_MAX_TASKS))
+    {
+        return TEST_SCHEDULE_BAD_PARAM;
+    }
+
+    /* Check the tasks and find the schedule length */
+    for (uint8_t i = 0u; i < task_count; i++)
+    {
+        plan->failed_task = i;
+
+        if ((0u == tasks[i].slices) || (0u == tasks[i].period_ticks))
+        {
+            return TEST_SCHEDULE_BAD_PARAM;
+        }
+        if (tasks[i].irq_off_cycles > tasks[i].irq_off_limit)
+        {
+            return TEST_SCHEDULE_IRQ_LIMIT;
+        }
+
+        ticks = (ticks / Test_Schedule_Gcd(ticks, tasks[i].period_ticks)) * tasks[i].period_ticks;
+        if (ticks > TEST_SCHEDULE_MAX_TICKS)
+        {
+            return TEST_SCHEDULE_TOO_LONG;
+        }
+    }
+
+    for (uint8_t i = 0u; i < task_count; i++)
+    {
+        plan->failed_task = i;
+        slots += (ticks / tasks[i].period_ticks) * tasks[i].slices;
+        if (slots > TEST_SCHEDULE_MAX_ENTRIES)
+        {
+            return TEST_SCHEDULE_TOO_LONG;
+        }
+    }
+
+    /* Most expensive slices first (insertion sort, the table is small) */
+    for (uint8_t i = 0u; i < task_count; i++)
+    {
+        uint8_t j = i;
+        while ((j > 0u) && (tasks[order[j - 1u]].slice_cycles < tasks[i].slice_cycles))
+        {
+            order[j] = order[j - 1u];
+            j--;
+        }
+        order[j] = i;
+    }
+
+    /* Place every slice on the least loaded tick of its period window */
+    (void)memset(plan_load, 0, sizeof(plan_load));
+    slots = 0u;
+    for (uint8_t i = 0u; i < task_count; i++)
+    {
+        const test_task_t *task = &tasks[order[i]];
+
+        plan->failed_task = order[i];
+        for (uint32_t window = 0u; window < ticks; window += task->period_ticks)
+        {
+            for (uint16_t slice = 0u; slice < task->slices; slice++)
+            {
+                uint32_t best = window;
+
+                for (uint32_t tick = window + 1u; tick < (window + task->period_ticks); tick++)
+                {
+                    if (plan_load[tick] < plan_load[best])
+                    {
+                        best = tick;
+                    }
+                }
+
+                plan_load[best] += task->slice_cycles;
+                if (plan_load[best] > tick_budget)
+                {
+                    return TEST_SCHEDULE_OVERLOAD;
+                }
+                if (plan_load[best] > plan->peak_cycles)
+                {
+                    plan->peak_cycles = plan_load[best];
+                }
+
+                plan_slot_tick[slots] = (uint16_t)best;
+                plan_slot_task[slots] = order[i];
+                slots++;
+            }
+        }
+    }
+
+    /* Group the slices by tick */
+    for (uint32_t i = 0u; i < slots; i++)
+    {
+        plan->tick_start[plan_slot_tick[i] + 1u]++;
+    }
+    for (uint32_t tick = 0u; tick < ticks; tick++)
+    {
+        plan->tick_start[tick + 1u] += plan->tick_start[tick];
+    }
+    (void)memset(plan_load, 0, sizeof(plan_load));
+    for (uint32_t i = 0u; i < slots; i++)
+    {
+        const uint16_t tick = plan_slot_tick[i];
+        plan->entries[plan->tick_start[tick] + plan_load[tick]] = plan_slot_task[i];
+        plan_load[tick]++;
+    }
+
+    plan->ticks = (uint16_t)ticks;
+    plan->entry_count = (uint16_t)slots;
+    plan->failed_task = 0u;
+
+    return TEST_SCHEDULE_OK;
+}
+
+/*****************************************************************************
+ * Function Name: Test_Schedule_Start
+ ******************************************************************************
+ * Summary:
+ * Starts the runner on a schedule, from Test_Schedule_Plan() or a constant
+ * table generated by the host planner.
+ *
+ * Parameters:
+ *  tasks  : Task table the schedule was planned for
+ *  plan   : Schedule
+ *  report : Called with the status of every slice
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+void Test_Schedule_Start(const test_task_t *tasks, const test_schedule_plan_t *plan,
+                         test_schedule_report_t report)
+{
+    run_tasks = tasks;
+    run_plan = plan;
+    run_report = report;
+    run_tick = 0u;
+}
+
+/*****************************************************************************
+ * Function Name: Test_Schedule_Tick
+ ******************************************************************************
+ * Summary:
+ * Runs the slices of the current tick and moves to the next tick. The slices
+ * of a tick are found by one table lookup.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+void Test_Schedule_Tick(void)
+{
+    if (NULL == run_plan)
+    {
+        return;
+    }
+
+    for (uint16_t i = run_plan->tick_start[run_tick]; i < run_plan->tick_start[run_tick + 1u]; i++)
+    {
+        const uint8_t task = run_plan->entries[i];
+        const uint8_t status = run_tasks[task].slice();
+
+        if (NULL != run_report)
+        {
+            run_report(task, status);
+        }
+    }
+
+    run_tick++;
+    if (run_tick >= run_plan->ticks)
+    {
+        run_tick = 0u;
+    }
+}
+
+
+/*****************************************************************************
+ * Function Name: Test_Schedule_Advance
+ ******************************************************************************
+ * Summary:
+ * Runs the slices of a number of ticks in one go, used when the ticks are
+ * counted by a time base that keeps running while the CPU sleeps. Slices are
+ * atomic, so a multi-slice test run continues where it stopped.
+ *
+ * Parameters:
+ *  ticks : Number of elapsed ticks
+ *
+ * Return:
+ *  uint32_t : Number of times the schedule wrapped around
+ *****************************************************************************/
+uint32_t Test_Schedule_Advance(uint32_t ticks)
+{
+    uint32_t wraps = 0u;
+
+    if (NULL == run_plan)
+    {
+        return 0u;
+    }
+
+    for (uint32_t i = 0u; i < ticks; i++)
+    {
+        /* Empty ticks only move the position */
+        if (run_plan->tick_start[run_tick] != run_plan->tick_start[run_tick + 1u])
+        {
+            Test_Schedule_Tick();
+        }
+        else
+        {
+            run_tick = (uint16_t)((run_tick + 1u) % run_plan->ticks);
+        }
+
+        if (0u == run_tick)
+        {
+            wraps++;
+        }
+    }
+
+    return wraps;
+}
+
+/*****************************************************************************
+ * Function Name: Test_Schedule_NextDue
+ ******************************************************************************
+ * Summary:
+ * Returns the number of empty ticks before the next tick that has slices.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint32_t : 0 if the current tick has slices, the schedule length if the
+ *  schedule has no slices at all
+ *****************************************************************************/
+uint32_t Test_Schedule_NextDue(void)
+{
+    uint32_t gap = 0u;
+
+    if (NULL == run_plan)
+    {
+        return 0u;
+    }
+
+    while (gap < run_plan->ticks)
+    {
+        const uint32_t tick = (run_tick + gap) % run_plan->ticks;
+
+        if (run_plan->tick_start[tick] != run_plan->tick_start[tick + 1u])
+        {
+            break;
+        }
+        gap++;
+    }
+
+    return gap;
+}
+
+
+/* [] END OF FILE */
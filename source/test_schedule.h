@@ -0,0 +1,118 @@
+/******************************************************************************
+ * File Name:   test_schedule.h
+ *
+ * Description: This file is the public interface of test_schedule.c source file.
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+/*******************************************************************************
+ * Include guard
+ *******************************************************************************/
+#ifndef TEST_SCHEDULE_H_
+#define TEST_SCHEDULE_H_
+
+#include <stdint.h>
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+#define TEST_SCHEDULE_MAX_TASKS         (16u)
+/* Longest schedule (least common multiple of the task periods) in ticks */
+#define TEST_SCHEDULE_MAX_TICKS         (256u)
+/* Most slices in one schedule */
+#define TEST_SCHEDULE_MAX_ENTRIES       (1024u)
+
+/*******************************************************************************
+ * Data Types
+ *******************************************************************************/
+typedef enum
+{
+    TEST_SCHEDULE_OK = 0,           /* Schedule meets all constraints */
+    TEST_SCHEDULE_BAD_PARAM,        /* Task with no slices or a zero period */
+    TEST_SCHEDULE_TOO_LONG,         /* Schedule exceeds MAX_TICKS or MAX_ENTRIES */
+    TEST_SCHEDULE_IRQ_LIMIT,        /* A slice keeps interrupts off for too long */
+    TEST_SCHEDULE_OVERLOAD          /* Peak tick load exceeds the tick budget */
+} test_schedule_status_t;
+
+/* Runs one slice of a test, returns the self test status */
+typedef uint8_t (*test_slice_func_t)(void);
+
+/* Called with the status of every slice the runner executes */
+typedef void (*test_schedule_report_t)(uint8_t task, uint8_t status);
+
+/* Measured cost and required period of a periodic test */
+typedef struct
+{
+    const char        *name;
+    test_slice_func_t  slice;
+    uint8_t            test_id;         /* Test index used in reports */
+    uint16_t           slices;          /* Slices per complete test run */
+    uint32_t           slice_cycles;    /* Worst case CPU cycles of one slice */
+    uint16_t           period_ticks;    /* Diagnostic interval, in ticks */
+    uint32_t           irq_off_cycles;  /* Worst case interrupt-off time of one slice */
+    uint32_t           irq_off_limit;   /* Allowed interrupt-off time */
+} test_task_t;
+
+/* Static slice schedule. The slices of tick t are
+ * entries[tick_start[t]] .. entries[tick_start[t + 1] - 1]. */
+typedef struct
+{
+    uint16_t ticks;                                 /* Schedule length */
+    uint16_t entry_count;
+    uint32_t peak_cycles;                           /* Highest tick load */
+    uint8_t  failed_task;                           /* Task violating a constraint */
+    uint16_t tick_start[TEST_SCHEDULE_MAX_TICKS + 1u];
+    uint8_t  entries[TEST_SCHEDULE_MAX_ENTRIES];    /* Task index per slice */
+} test_schedule_plan_t;
+
+/*******************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+test_schedule_status_t Test_Schedule_Plan(const test_task_t *tasks, uint8_t task_count,
+                                          uint32_t tick_budget, test_schedule_plan_t *plan);
+void Test_Schedule_Start(const test_task_t *tasks, const test_schedule_plan_t *plan,
+                         test_schedule_report_t report);
+void Test_Schedule_Tick(void);
+uint32_t Test_Schedule_Advance(uint32_t ticks);
+uint32_t Test_Schedule_NextDue(void);
+
+#endif /* TEST_SCHEDULE_H_ */
+
+
+/* [] END OF FILE */
@@ -0,0 +1,111 @@
+/******************************************************************************
+ * File Name:   test_schedule_cfg.h
+ *
+ * Description: This file holds the measured costs and required periods of the
+ * periodic self tests, shared by the target and the host planner
+ * (tools/schedule_planner.c).
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+/*******************************************************************************
+ * Include guard
+ *******************************************************************************/
+#ifndef TEST_SCHEDULE_CFG_H_
+#define TEST_SCHEDULE_CFG_H_
+
+#include "cfg_snapshot_cfg.h"
+#include "ipc_bench.h"
+#include "fpu_slice_test.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+/* Scheduler tick period and the share of it the tests may use */
+#define TEST_SCHEDULE_TICK_MS           (10u)
+#define TEST_SCHEDULE_CPU_HZ            (180000000UL)
+#define TEST_SCHEDULE_TICK_CYCLES       ((TEST_SCHEDULE_CPU_HZ / 1000u) * TEST_SCHEDULE_TICK_MS)
+#define TEST_SCHEDULE_TICK_BUDGET       (TEST_SCHEDULE_TICK_CYCLES / 20u)   /* 5 % CPU load */
+
+/* Longest time interrupts may be disabled by one slice (about 280 us) */
+#define TEST_SCHEDULE_IRQ_OFF_LIMIT     (50000u)
+
+/* Slices of one complete flash test run:
+ * (FLASH_TEST_END_ADDR - CY_FLASH_BASE) / (8 * FLASH_DOUBLE_WORDS_TO_TEST), rounded up,
+ * 0x1DDF8 / (8 * 64). Both are checked in self_test.c. */
+#define TEST_SCHEDULE_FLASH_SLICES      (239u)
+/* Slices of one complete SRAM test run: BLOCK_SIZE / BUFFER_SIZE */
+#define TEST_SCHEDULE_SRAM_SLICES       (64u)
+
+/* Memory covered by one slice of the SRAM, stack and flash tests:
+ * BUFFER_SIZE, TEST_STACK_SIZE and 8 * FLASH_DOUBLE_WORDS_TO_TEST, checked in
+ * self_test.c */
+#define TEST_SCHEDULE_SRAM_SLICE_BYTES  (512u)
+#define TEST_SCHEDULE_STACK_SLICE_BYTES (0x800u)
+#define TEST_SCHEDULE_FLASH_SLICE_BYTES (512u)
+
+/* Periodic tests:
+ * X(name, slice function, test index, slices per run, cycles per slice,
+ *   period in ticks, interrupt-off cycles per slice, interrupt-off limit,
+ *   bytes per slice)
+ *
+ * The test index must be a plain literal, the tables generated by
+ * tools/schedule_planner refer to the tasks by it. The bytes per slice are
+ * the memory one slice tests, 0 for tests that do not test memory; the
+ * PERF_BENCH build reports them.
+ *
+ * The cycle counts are estimates for 180 MHz. Replace them with the worst
+ * case values measured with the cycle counter (the "cycles" field of the
+ * binary telemetry records) plus a margin, and measure again after changing
+ * the library, the compiler or the optimization level. */
+#define TEST_SCHEDULE_TASKS(X) \
+    X("Start-Up Register Test", Start_Up_Check_Slice,     1u,  CFG_SNAPSHOT_SLICES,            400u,   100u, 0u,     TEST_SCHEDULE_IRQ_OFF_LIMIT, (CFG_SNAPSHOT_SLICE_REGS * 4u)) \
+    X("Program Counter Test",  SelfTest_PC,               2u,  1u,                             600u,   10u,  0u,     TEST_SCHEDULE_IRQ_OFF_LIMIT, 0u) \
+    X("CPU Register Test",     SelfTest_CPU_Registers,    3u,  1u,                             2500u,  10u,  2500u,  TEST_SCHEDULE_IRQ_OFF_LIMIT, 0u) \
+    X("Program Flow Test",     SelfTest_PROGRAM_FLOW,     4u,  1u,                             1200u,  10u,  0u,     TEST_SCHEDULE_IRQ_OFF_LIMIT, 0u) \
+    X("FPU Register Test",     Fpu_Slice_Test,            7u,  FPU_SLICE_COUNT,                600u,   50u,  400u,   TEST_SCHEDULE_IRQ_OFF_LIMIT, 0u) \
+    X("IPC Test",              IPC_Test_Slice,            9u,  IPC_BENCH_SLICE_COUNT,          15000u, 100u, 0u,     TEST_SCHEDULE_IRQ_OFF_LIMIT, 0u) \
+    X("SRAM Test",             SRAM_March_Slice,          12u, TEST_SCHEDULE_SRAM_SLICES,      10000u, 100u, 10000u, TEST_SCHEDULE_IRQ_OFF_LIMIT, TEST_SCHEDULE_SRAM_SLICE_BYTES) \
+    X("Stack March Test",      Stack_March_Slice,         13u, 1u,                             40000u, 100u, 40000u, TEST_SCHEDULE_IRQ_OFF_LIMIT, TEST_SCHEDULE_STACK_SLICE_BYTES) \
+    X("Stack Memory Test",     Stack_Check_Slice,         14u, 1u,                             8000u,  10u,  0u,     TEST_SCHEDULE_IRQ_OFF_LIMIT, 0u) \
+    X("Flash Test",            Flash_Test_Slice,          15u, TEST_SCHEDULE_FLASH_SLICES,     7500u,  200u, 0u,     TEST_SCHEDULE_IRQ_OFF_LIMIT, TEST_SCHEDULE_FLASH_SLICE_BYTES)
+
+#endif /* TEST_SCHEDULE_CFG_H_ */
+
+
+/* [] END OF FILE */
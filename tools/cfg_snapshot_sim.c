@@ -0,0 +1,370 @@
+/******************************************************************************
+ * File Name:   cfg_snapshot_sim.c
+ *
+ * Description: Host checks of the start-up register snapshot hash
+ * (source/cfg_snapshot.c): change detection, sliced hashing, record
+ * validation, and the flash writes of the write-if-changed snapshot over
+ * simulated reboots.
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cfg_snapshot.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+#define SIM_REG_COUNT       (16u)
+#define SIM_VERSION         (1u)
+
+/*******************************************************************************
+ * Global Variables
+ *******************************************************************************/
+static uint32_t sim_regs[SIM_REG_COUNT];
+static const volatile uint32_t *sim_reg_table[SIM_REG_COUNT];
+static uint64_t sim_rng = 1u;
+
+/*******************************************************************************
+ * Function Definitions
+ *******************************************************************************/
+
+/*****************************************************************************
+ * Function Name: Sim_Random
+ ******************************************************************************
+ * Summary:
+ * splitmix64 pseudo random numbers.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint32_t : Random value
+ *****************************************************************************/
+static uint32_t Sim_Random(void)
+{
+    uint64_t z = (sim_rng += 0x9E3779B97F4A7C15ULL);
+
+    z = (z ^ (z >> 30u)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27u)) * 0x94D049BB133111EBULL;
+    return (uint32_t)((z ^ (z >> 31u)) >> 32u);
+}
+
+/*****************************************************************************
+ * Function Name: Check_Single_Changes
+ ******************************************************************************
+ * Summary:
+ * Flips every bit and sets every byte of every register to every other
+ * value; each change must change the hash.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  int : Number of undetected changes
+ *****************************************************************************/
+static int Check_Single_Changes(void)
+{
+    const uint32_t reference = Cfg_Snapshot_Hash(sim_reg_table, SIM_REG_COUNT, 0u);
+    int missed = 0;
+
+    for (uint32_t r = 0u; r < SIM_REG_COUNT; r++)
+    {
+        const uint32_t saved = sim_regs[r];
+
+        for (uint32_t byte = 0u; byte < 4u; byte++)
+        {
+            for (uint32_t value = 0u; value < 256u; value++)
+            {
+                sim_regs[r] = (saved & ~(0xFFu << (byte * 8u))) | (value << (byte * 8u));
+                if ((sim_regs[r] != saved) && (reference == Cfg_Snapshot_Hash(sim_reg_table, SIM_REG_COUNT, 0u)))
+                {
+                    missed++;
+                }
+            }
+        }
+        sim_regs[r] = saved;
+    }
+
+    return missed;
+}
+
+/*****************************************************************************
+ * Function Name: Check_Random_Changes
+ ******************************************************************************
+ * Summary:
+ * Changes several random registers at once; counts hash collisions.
+ *
+ * Parameters:
+ *  trials : Number of changes
+ *
+ * Return:
+ *  int : Number of undetected changes
+ *****************************************************************************/
+static int Check_Random_Changes(uint32_t trials)
+{
+    const uint32_t reference = Cfg_Snapshot_Hash(sim_reg_table, SIM_REG_COUNT, 0u);
+    uint32_t saved[SIM_REG_COUNT];
+    int missed = 0;
+
+    memcpy(saved, sim_regs, sizeof(saved));
+    for (uint32_t t = 0u; t < trials; t++)
+    {
+        const uint32_t changes = 2u + (Sim_Random() % 4u);
+
+        for (uint32_t c = 0u; c < changes; c++)
+        {
+            sim_regs[Sim_Random() % SIM_REG_COUNT] ^= Sim_Random() | 1u;
+        }
+        if ((0 != memcmp(saved, sim_regs, sizeof(saved))) &&
+            (reference == Cfg_Snapshot_Hash(sim_reg_table, SIM_REG_COUNT, 0u)))
+        {
+            missed++;
+        }
+        memcpy(sim_regs, saved, sizeof(saved));
+    }
+
+    return missed;
+}
+
+/*****************************************************************************
+ * Function Name: Check_Slices
+ ******************************************************************************
+ * Summary:
+ * The sliced hash must equal the one-shot hash for every slice size and
+ * seed.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  int : Number of mismatches
+ *****************************************************************************/
+static int Check_Slices(void)
+{
+    int errors = 0;
+
+    for (uint32_t seed = 0u; seed < 4u; seed++)
+    {
+        const uint32_t reference = Cfg_Snapshot_Hash(sim_reg_table, SIM_REG_COUNT, seed);
+
+        for (uint16_t slice = 1u; slice <= (SIM_REG_COUNT + 1u); slice++)
+        {
+            cfg_snapshot_ctx_t ctx;
+            uint32_t steps = 1u;
+
+            Cfg_Snapshot_Begin(&ctx, sim_reg_table, SIM_REG_COUNT, seed);
+            while (!Cfg_Snapshot_Step(&ctx, slice))
+            {
+                steps++;
+            }
+            if ((reference != ctx.hash) || (steps != ((SIM_REG_COUNT + slice - 1u) / slice)))
+            {
+                errors++;
+            }
+        }
+
+        /* A different seed (image) must give a different hash */
+        if ((0u != seed) && (reference == Cfg_Snapshot_Hash(sim_reg_table, SIM_REG_COUNT, 0u)))
+        {
+            errors++;
+        }
+    }
+
+    return errors;
+}
+
+/*****************************************************************************
+ * Function Name: Check_Record
+ ******************************************************************************
+ * Summary:
+ * A record must match its own parameters, and every bit flip, an erased
+ * record and a changed version or count must be rejected.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  int : Number of errors
+ *****************************************************************************/
+static int Check_Record(void)
+{
+    cfg_snapshot_record_t record;
+    cfg_snapshot_record_t erased;
+    int errors = 0;
+
+    Cfg_Snapshot_MakeRecord(&record, SIM_VERSION, SIM_REG_COUNT, 0x12345678u, 7u);
+    errors += Cfg_Snapshot_Matches(&record, SIM_VERSION, SIM_REG_COUNT, 0x12345678u) ? 0 : 1;
+    errors += Cfg_Snapshot_Matches(&record, SIM_VERSION + 1u, SIM_REG_COUNT, 0x12345678u) ? 1 : 0;
+    errors += Cfg_Snapshot_Matches(&record, SIM_VERSION, SIM_REG_COUNT - 1u, 0x12345678u) ? 1 : 0;
+    errors += Cfg_Snapshot_Matches(&record, SIM_VERSION, SIM_REG_COUNT, 0x12345679u) ? 1 : 0;
+
+    for (uint32_t bit = 0u; bit < (8u * sizeof(record)); bit++)
+    {
+        cfg_snapshot_record_t corrupted = record;
+
+        ((uint8_t *)&corrupted)[bit / 8u] ^= (uint8_t)(1u << (bit % 8u));
+        errors += Cfg_Snapshot_IsValid(&corrupted) ? 1 : 0;
+    }
+
+    memset(&erased, 0xFF, sizeof(erased));
+    errors += Cfg_Snapshot_IsValid(&erased) ? 1 : 0;
+    memset(&erased, 0x00, sizeof(erased));
+    errors += Cfg_Snapshot_IsValid(&erased) ? 1 : 0;
+
+    return errors;
+}
+
+/*****************************************************************************
+ * Function Name: Simulate_Boots
+ ******************************************************************************
+ * Summary:
+ * Simulates reboots where the configuration changes with a given
+ * probability, as Start_Up_Test() does: the library compares the registers
+ * with its saved copy, a mismatch saves a new copy and checks again. Counts
+ * the flash writes and the failed checks. Prints the result.
+ *
+ * Parameters:
+ *  boots       : Number of reboots
+ *  change_pct  : Probability of a configuration change per boot, percent
+ *
+ * Return:
+ *  int : 1 if more writes than configuration changes (+1 first save), or if
+ *  a check failed
+ *****************************************************************************/
+static int Simulate_Boots(uint32_t boots, uint32_t change_pct)
+{
+    uint32_t saved[SIM_REG_COUNT];
+    bool saved_valid = false;
+    uint32_t changes = 0u;
+    uint32_t writes = 0u;
+    uint32_t failures = 0u;
+
+    for (uint32_t b = 0u; b < boots; b++)
+    {
+        if ((Sim_Random() % 100u) < change_pct)
+        {
+            sim_regs[Sim_Random() % SIM_REG_COUNT] ^= 1u << (Sim_Random() % 32u);
+            changes++;
+        }
+
+        /* SelfTests_StartUp_ConfigReg(), SelfTests_Save_StartUp_ConfigReg() */
+        if (!saved_valid || (0 != memcmp(saved, sim_regs, sizeof(saved))))
+        {
+            memcpy(saved, sim_regs, sizeof(saved));
+            saved_valid = true;
+            writes++;
+            if (0 != memcmp(saved, sim_regs, sizeof(saved)))
+            {
+                failures++;
+            }
+        }
+    }
+
+    printf("boots,change_pct,config_changes,flash_writes,always_save_writes,failed_checks\n");
+    printf("%u,%u,%u,%u,%u,%u\n", (unsigned)boots, (unsigned)change_pct, (unsigned)changes, (unsigned)writes,
+           (unsigned)boots, (unsigned)failures);
+
+    return ((writes <= (changes + 1u)) && (0u == failures)) ? 0 : 1;
+}
+
+/*****************************************************************************
+ * Function Name: main
+ ******************************************************************************
+ * Summary:
+ * Usage: cfg_snapshot_sim [-n boots] [-c change_percent] [-s seed]
+ *
+ * Return:
+ *  int : 0 if all checks pass, 1 otherwise
+ *****************************************************************************/
+int main(int argc, char *argv[])
+{
+    uint32_t boots = 10000u;
+    uint32_t change_pct = 1u;
+    int missed_single;
+    int missed_random;
+    int slice_errors;
+    int record_errors;
+    int boot_errors;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((0 == strcmp(argv[i], "-n")) && ((i + 1) < argc))
+        {
+            boots = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if ((0 == strcmp(argv[i], "-c")) && ((i + 1) < argc))
+        {
+            change_pct = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if ((0 == strcmp(argv[i], "-s")) && ((i + 1) < argc))
+        {
+            sim_rng = strtoull(argv[++i], NULL, 0);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-n boots] [-c change_percent] [-s seed]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    for (uint32_t r = 0u; r < SIM_REG_COUNT; r++)
+    {
+        sim_regs[r] = Sim_Random();
+        sim_reg_table[r] = &sim_regs[r];
+    }
+
+    missed_single = Check_Single_Changes();
+    missed_random = Check_Random_Changes(1000000u);
+    slice_errors = Check_Slices();
+    record_errors = Check_Record();
+    boot_errors = Simulate_Boots(boots, change_pct);
+
+    fprintf(stderr, "single byte changes missed: %d\n", missed_single);
+    fprintf(stderr, "multi register changes missed: %d of 1000000\n", missed_random);
+    fprintf(stderr, "sliced hash mismatches: %d\n", slice_errors);
+    fprintf(stderr, "record check errors: %d\n", record_errors);
+
+    /* Multi register collisions are possible (2^-32 each), not an error */
+    return ((0 == missed_single) && (0 == slice_errors) && (0 == record_errors) && (0 == boot_errors)) ? 0 : 1;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,481 @@
+/******************************************************************************
+ * File Name:   clock_monitor_sim.c
+ *
+ * Description: Host simulation of the background clock monitor. Runs
+ * source/clock_monitor.c against simulated clock measurement counters,
+ * with injected clock deviations and a second counter user, and checks
+ * that every source is measured, classified and reported as expected.
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "clock_monitor.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+/* Simulated measurement clocks, stand-ins for cy_en_meas_clks_t */
+#define CY_SYSCLK_MEAS_CLK_ILO          (1u)
+#define CY_SYSCLK_MEAS_CLK_ECO          (2u)
+#define CY_SYSCLK_MEAS_CLK_PATH_CLK0    (0x500u)
+#define CY_SYSCLK_MEAS_CLK_PATH_CLK1    (0x501u)
+#define CY_SYSCLK_MEAS_CLK_CLK_HF0      (0x600u)
+#define CY_SYSCLK_MEAS_CLK_CLK_HF1      (0x601u)
+#define CY_SYSCLK_MEAS_CLK_CLK_HF2      (0x602u)
+#define CY_SYSCLK_MEAS_CLK_CLK_HF3      (0x603u)
+
+#include "clock_monitor_cfg.h"
+
+/* IMO cycles between two polls (25 us) */
+#define SIM_POLL_CYCLES                 (200u)
+/* CPU cycles per IMO cycle, 180 MHz / 8 MHz as a fraction */
+#define SIM_CPU_PER_IMO_NUM             (45u)
+#define SIM_CPU_PER_IMO_DEN             (2u)
+/* IMO cycles the ILO trim holds the counters */
+#define SIM_TRIM_CYCLES                 (4u * CLOCK_MONITOR_REF_COUNT)
+
+/*******************************************************************************
+ * Data Types
+ *******************************************************************************/
+/* User of the measurement counters */
+typedef enum
+{
+    SIM_OWNER_NONE = 0,
+    SIM_OWNER_MONITOR,
+    SIM_OWNER_TRIM
+} sim_owner_t;
+
+typedef struct
+{
+    uint32_t nominal;       /* Configured frequency, 0 if not active */
+    double   deviation;     /* Injected deviation, ppm */
+} sim_clock_t;
+
+/*******************************************************************************
+ * Global Variables
+ *******************************************************************************/
+#define SIM_SOURCE_ENTRY(name, clock, tolerance, slow) \
+        { (name), (uint32_t)(clock), (tolerance), (slow) },
+static const clock_monitor_source_t sources[] =
+{
+    CLOCK_MONITOR_SOURCES(SIM_SOURCE_ENTRY)
+};
+#define SOURCE_COUNT (sizeof(sources) / sizeof(sources[0]))
+
+/* Default clock tree: FLL 100 MHz, PLL 180 MHz, ECO not fitted */
+static sim_clock_t clocks[SOURCE_COUNT] =
+{
+    { 32768u, 0.0 }, { 0u, 0.0 }, { 100000000u, 0.0 }, { 180000000u, 0.0 },
+    { 180000000u, 0.0 }, { 100000000u, 0.0 }, { 0u, 0.0 }, { 0u, 0.0 }
+};
+
+static uint64_t    sim_now = 0u;        /* IMO cycles */
+static uint64_t    sim_done_at = 0u;    /* UINT64_MAX: measured clock stopped */
+static sim_owner_t sim_owner = SIM_OWNER_NONE;
+static uint32_t    sim_busy_every = 0u;
+static uint32_t    sim_count2 = 0u;
+static uint32_t    sim_stolen = 0u;     /* Monitor measurements overwritten */
+static uint32_t    sim_timeouts = 0u;
+static uint32_t    sim_trims = 0u;      /* ILO trim measurements started */
+static bool        sim_trim_pending = false;
+static bool        sim_refuse = false;  /* Counters never restart */
+
+/*******************************************************************************
+ * Function Definitions
+ *******************************************************************************/
+
+/*****************************************************************************
+ * Function Name: Sim_Index
+ ******************************************************************************
+ * Summary:
+ * Returns the index of a source in the simulated clock table.
+ *
+ * Parameters:
+ *  source : Clock source
+ *
+ * Return:
+ *  size_t : Index
+ *****************************************************************************/
+static size_t Sim_Index(const clock_monitor_source_t *source)
+{
+    return (size_t)(source - sources);
+}
+
+/*****************************************************************************
+ * Function Name: Sim_Actual
+ ******************************************************************************
+ * Summary:
+ * Returns the actual frequency of a source, nominal plus injected deviation.
+ *
+ * Parameters:
+ *  source : Clock source
+ *
+ * Return:
+ *  double : Hz
+ *****************************************************************************/
+static double Sim_Actual(const clock_monitor_source_t *source)
+{
+    const sim_clock_t *clock = &clocks[Sim_Index(source)];
+
+    return (double)clock->nominal * (1.0 + (clock->deviation / 1e6));
+}
+
+/*****************************************************************************
+ * Function Name: Sim_Start
+ ******************************************************************************
+ * Summary:
+ * Simulated counter start. Computes the counter 2 value the hardware would
+ * capture and when the measurement completes. Like Clock_Monitor_HwStart(),
+ * refuses while the ILO trim holds the counters, and always with -r.
+ *
+ * Parameters:
+ *  source : Clock source
+ *
+ * Return:
+ *  bool : false while the counters are in use
+ *****************************************************************************/
+static bool Sim_Start(const clock_monitor_source_t *source)
+{
+    const double actual = Sim_Actual(source);
+    uint64_t window;
+
+    if ((SIM_OWNER_TRIM == sim_owner) || sim_refuse)
+    {
+        return false;
+    }
+
+    if (actual <= 0.0)
+    {
+        /* Stopped clock: a slow one never ends the window, a fast one counts 0 */
+        window = source->slow ? UINT64_MAX : CLOCK_MONITOR_REF_COUNT;
+        sim_count2 = 0u;
+    }
+    else if (source->slow)
+    {
+        /* Counter 1 counts the slow clock, counter 2 the IMO */
+        window = (uint64_t)(((double)CLOCK_MONITOR_SLOW_COUNT * CLOCK_MONITOR_REF_HZ) / actual);
+        sim_count2 = (uint32_t)window;
+    }
+    else
+    {
+        window = CLOCK_MONITOR_REF_COUNT;
+        sim_count2 = (uint32_t)((actual * CLOCK_MONITOR_REF_COUNT) / CLOCK_MONITOR_REF_HZ);
+    }
+
+    sim_owner = SIM_OWNER_MONITOR;
+    sim_done_at = (UINT64_MAX == window) ? UINT64_MAX : (sim_now + window);
+    return true;
+}
+
+/*****************************************************************************
+ * Function Name: Sim_Done
+ ******************************************************************************
+ * Summary:
+ * Simulated counter done flag.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  bool : true when the measurement window has passed
+ *****************************************************************************/
+static bool Sim_Done(void)
+{
+    return (SIM_OWNER_MONITOR == sim_owner) && (sim_now >= sim_done_at);
+}
+
+/*****************************************************************************
+ * Function Name: Sim_GetFreq
+ ******************************************************************************
+ * Summary:
+ * Converts the captured counter values to a frequency, as
+ * Cy_SysClk_ClkMeasurementCountersGetFreq() does.
+ *
+ * Parameters:
+ *  source : Clock source
+ *
+ * Return:
+ *  uint32_t : Hz
+ *****************************************************************************/
+static uint32_t Sim_GetFreq(const clock_monitor_source_t *source)
+{
+    sim_owner = SIM_OWNER_NONE;
+
+    if (source->slow)
+    {
+        return (uint32_t)(((uint64_t)CLOCK_MONITOR_REF_HZ * CLOCK_MONITOR_SLOW_COUNT) / sim_count2);
+    }
+    return (uint32_t)(((uint64_t)sim_count2 * CLOCK_MONITOR_REF_HZ) / CLOCK_MONITOR_REF_COUNT);
+}
+
+/*****************************************************************************
+ * Function Name: Sim_Expected
+ ******************************************************************************
+ * Summary:
+ * Simulated clock tree configuration.
+ *
+ * Parameters:
+ *  source : Clock source
+ *
+ * Return:
+ *  uint32_t : Configured Hz, 0 if not active
+ *****************************************************************************/
+static uint32_t Sim_Expected(const clock_monitor_source_t *source)
+{
+    return clocks[Sim_Index(source)].nominal;
+}
+
+/*****************************************************************************
+ * Function Name: Sim_Now
+ ******************************************************************************
+ * Summary:
+ * Simulated CPU cycle counter.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint32_t : CPU cycles (modulo 2^32)
+ *****************************************************************************/
+static uint32_t Sim_Now(void)
+{
+    return (uint32_t)((sim_now * SIM_CPU_PER_IMO_NUM) / SIM_CPU_PER_IMO_DEN);
+}
+
+/*****************************************************************************
+ * Function Name: Sim_Abort
+ ******************************************************************************
+ * Summary:
+ * Simulated abort of a measurement that did not complete. The next start
+ * programs the counters again.
+ *
+ * Parameters:
+ *  source : Clock source
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+static void Sim_Abort(const clock_monitor_source_t *source)
+{
+    (void)source;
+
+    sim_owner = SIM_OWNER_NONE;
+    sim_timeouts++;
+}
+
+/*****************************************************************************
+ * Function Name: Sim_Trim_Poll
+ ******************************************************************************
+ * Summary:
+ * The ILO trim as the other user of the counters, as Ilo_Trim_Poll() does:
+ * requests a measurement every busy_every polls and starts it as soon as the
+ * monitor does not hold the counters. A start while the monitor measurement
+ * is open, completed or not, overwrites it.
+ *
+ * Parameters:
+ *  polls : Polls so far
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+static void Sim_Trim_Poll(uint32_t polls)
+{
+    if ((0u != sim_busy_every) && (0u == (polls % sim_busy_every)))
+    {
+        sim_trim_pending = true;
+    }
+
+    if (SIM_OWNER_TRIM == sim_owner)
+    {
+        if (sim_now >= sim_done_at)
+        {
+            sim_owner = SIM_OWNER_NONE;
+        }
+    }
+    else if (sim_trim_pending && !Clock_Monitor_IsBusy())
+    {
+        if (SIM_OWNER_MONITOR == sim_owner)
+        {
+            sim_stolen++;
+        }
+        sim_owner = SIM_OWNER_TRIM;
+        sim_done_at = sim_now + SIM_TRIM_CYCLES;
+        sim_trims++;
+        sim_trim_pending = false;
+    }
+    else
+    {
+        /* Not due or the monitor holds the counters */
+    }
+}
+
+static const clock_monitor_ops_t sim_ops =
+{
+    Sim_Start, Sim_Done, Sim_GetFreq, Sim_Expected, Sim_Now, Sim_Abort
+};
+
+/*****************************************************************************
+ * Function Name: main
+ ******************************************************************************
+ * Summary:
+ * Usage: clock_monitor_sim [-p passes] [-b busy_every_polls] [-r]
+ *                          [-d source=ppm]... [-f source=hz]...
+ * -d injects a deviation (-1000000: stopped clock), -f sets the configured
+ * frequency (0: inactive). -b lets the simulated ILO trim start a
+ * measurement every busy_every polls. -r makes every counter start fail,
+ * which must fail all active sources instead of stalling the monitor.
+ *
+ * Return:
+ *  int : 0 if every source ended in the expected state and no monitor
+ *  measurement was overwritten, 1 otherwise
+ *****************************************************************************/
+int main(int argc, char *argv[])
+{
+    uint32_t passes = 3u;
+    uint32_t polls = 0u;
+    int errors = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((0 == strcmp(argv[i], "-p")) && ((i + 1) < argc))
+        {
+            passes = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if ((0 == strcmp(argv[i], "-b")) && ((i + 1) < argc))
+        {
+            sim_busy_every = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if (0 == strcmp(argv[i], "-r"))
+        {
+            sim_refuse = true;
+        }
+        else if (((0 == strcmp(argv[i], "-d")) || (0 == strcmp(argv[i], "-f"))) && ((i + 1) < argc))
+        {
+            const bool deviation = ('d' == argv[i][1]);
+            char *value = strchr(argv[++i], '=');
+            size_t s;
+
+            for (s = 0u; (NULL != value) && (s < SOURCE_COUNT); s++)
+            {
+                if ((strlen(sources[s].name) == (size_t)(value - argv[i])) &&
+                    (0 == strncmp(sources[s].name, argv[i], (size_t)(value - argv[i]))))
+                {
+                    break;
+                }
+            }
+            if ((NULL == value) || (s >= SOURCE_COUNT))
+            {
+                fprintf(stderr, "unknown source: %s\n", argv[i]);
+                return 1;
+            }
+            if (deviation)
+            {
+                clocks[s].deviation = strtod(value + 1, NULL);
+            }
+            else
+            {
+                clocks[s].nominal = (uint32_t)strtoul(value + 1, NULL, 0);
+            }
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-p passes] [-b busy_every_polls] [-r] [-d source=ppm]... [-f source=hz]...\n",
+                    argv[0]);
+            return 1;
+        }
+    }
+
+    Clock_Monitor_Start(sources, (uint8_t)SOURCE_COUNT, &sim_ops, NULL);
+
+    while ((Clock_Monitor_GetPasses() < passes) && (polls < 10000000u))
+    {
+        Sim_Trim_Poll(polls);
+        Clock_Monitor_Poll();
+        sim_now += SIM_POLL_CYCLES;
+        polls++;
+    }
+
+    printf("source,expected_hz,measured_hz,error_ppm,tolerance_ppm,runs,failures,state,check\n");
+    for (size_t s = 0u; s < SOURCE_COUNT; s++)
+    {
+        static const char *state_text[] = { "not_run", "pass", "fail", "inactive" };
+        const clock_monitor_result_t *result = Clock_Monitor_GetResult((uint8_t)s);
+        uint8_t want;
+        const char *check;
+
+        if (0u == clocks[s].nominal)
+        {
+            want = (uint8_t)CLOCK_MONITOR_INACTIVE;
+        }
+        else
+        {
+            want = (sim_refuse ||
+                    (clocks[s].deviation > (double)sources[s].tolerance_ppm) ||
+                    (clocks[s].deviation < -(double)sources[s].tolerance_ppm)) ?
+                   (uint8_t)CLOCK_MONITOR_FAIL : (uint8_t)CLOCK_MONITOR_PASS;
+        }
+        check = ((want == result->state) && ((CLOCK_MONITOR_INACTIVE == want) || (passes <= result->runs))) ?
+                "ok" : "MISMATCH";
+        if (0 != strcmp(check, "ok"))
+        {
+            errors++;
+        }
+
+        printf("%s,%u,%u,%d,%u,%u,%u,%s,%s\n", sources[s].name, (unsigned)result->expected,
+               (unsigned)result->measured, (int)result->error_ppm, (unsigned)sources[s].tolerance_ppm,
+               (unsigned)result->runs, (unsigned)result->failures, state_text[result->state], check);
+    }
+
+    if (0u != sim_stolen)
+    {
+        fprintf(stderr, "%u monitor measurements overwritten by the ILO trim\n", (unsigned)sim_stolen);
+        errors++;
+    }
+
+    fprintf(stderr, "%u trim measurements, %u timeouts, %u passes in %.2f ms simulated time (%u polls), %.2f ms per pass\n",
+            (unsigned)sim_trims, (unsigned)sim_timeouts, (unsigned)Clock_Monitor_GetPasses(), (double)sim_now / (CLOCK_MONITOR_REF_HZ / 1000.0),
+            (unsigned)polls, ((double)sim_now / (CLOCK_MONITOR_REF_HZ / 1000.0)) / (double)passes);
+
+    return (0 == errors) ? 0 : 1;
+}
+
+
+/* [] END OF FILE */
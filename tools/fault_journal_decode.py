@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+################################################################################
+# \file fault_journal_decode.py
+# \version 1.0
+#
+# \brief
+# Decodes a raw dump of the fault journal flash region (see
+# source/fault_journal.h) into CSV or JSON.
+#
+# Dump the region from the target, for example with OpenOCD:
+#   dump_image journal.bin 0x1201DE00 0x2000
+# and run:
+#   python3 fault_journal_decode.py journal.bin --format csv
+#
+################################################################################
+# \copyright
+# Copyright 2025, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import argparse
+import csv
+import json
+import struct
+import sys
+import zlib
+
+# Must match source/fault_journal.h
+ROW_SIZE = 512
+ROW_MAGIC = 0x4E524A46
+HDR_FORMAT = "<IIIHH"           # magic, crc, seq, boot, count
+HDR_SIZE = 16
+CRC_OFFSET = 8
+RECORD_FORMAT = "<IIBBH"        # timestamp, detail, test_id, status, reserved
+RECORD_SIZE = 12
+RECORDS_PER_ROW = (ROW_SIZE - HDR_SIZE) // RECORD_SIZE
+
+
+def parse_row(data):
+    """Returns the (seq, boot, records) of a valid row, or None."""
+    if len(data) != ROW_SIZE:
+        return None
+    magic, crc, seq, boot, count = struct.unpack_from(HDR_FORMAT, data, 0)
+    if magic != ROW_MAGIC or count > RECORDS_PER_ROW:
+        return None
+    if crc != (zlib.crc32(data[CRC_OFFSET:]) & 0xFFFFFFFF):
+        return None
+    records = []
+    for i in range(count):
+        timestamp, detail, test_id, status, _ = struct.unpack_from(
+            RECORD_FORMAT, data, HDR_SIZE + (i * RECORD_SIZE))
+        records.append({
+            "test_id": test_id,
+            "status": status,
+            "detail": "0x%08X" % detail,
+            "timestamp": timestamp,
+        })
+    return seq, boot, records
+
+
+def decode(image):
+    """Returns all records of the image, oldest row first."""
+    rows = []
+    for offset in range(0, len(image) - ROW_SIZE + 1, ROW_SIZE):
+        row = parse_row(image[offset:offset + ROW_SIZE])
+        if row is not None:
+            rows.append((offset // ROW_SIZE,) + row)
+
+    # Sequence numbers are 32-bit and may have wrapped around
+    wrapped = rows and (max(r[1] for r in rows) - min(r[1] for r in rows)) > 0x80000000
+    rows.sort(key=lambda r: r[1] + (0x100000000 if wrapped and r[1] < 0x80000000 else 0))
+
+    result = []
+    for index, seq, boot, records in rows:
+        for record in records:
+            result.append(dict(row=index, seq=seq, boot=boot, **record))
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("dump", help="raw binary dump of the journal region")
+    parser.add_argument("--format", choices=("csv", "json"), default="csv")
+    args = parser.parse_args()
+
+    with open(args.dump, "rb") as dump:
+        records = decode(dump.read())
+
+    if args.format == "json":
+        json.dump(records, sys.stdout, indent=2)
+        sys.stdout.write("\n")
+    else:
+        fields = ["row", "seq", "boot", "test_id", "status", "detail", "timestamp"]
+        writer = csv.DictWriter(sys.stdout, fieldnames=fields)
+        writer.writeheader()
+        writer.writerows(records)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,521 @@
+/******************************************************************************
+ * File Name:   fault_journal_fuzz.c
+ *
+ * Description: This file provides a host fuzz and property test of the fault
+ * journal row format: CRC, row validation, head search and row lookup,
+ * with torn, corrupted and random rows.
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fault_journal.h"
+
+/*******************************************************************************
+ * Global Variables
+ *******************************************************************************/
+/* Simulated journal region and the rows the writer meant to program */
+static fault_journal_row_t sim_rows[FAULT_JOURNAL_ROW_COUNT];
+static fault_journal_row_t model_rows[FAULT_JOURNAL_ROW_COUNT];
+static bool model_valid[FAULT_JOURNAL_ROW_COUNT];
+static uint64_t sim_rng = 1u;
+
+/*******************************************************************************
+ * Function Definitions
+ *******************************************************************************/
+
+/*****************************************************************************
+ * Function Name: Sim_Random
+ ******************************************************************************
+ * Summary:
+ * splitmix64 pseudo random numbers.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  uint32_t : Random value
+ *****************************************************************************/
+static uint32_t Sim_Random(void)
+{
+    uint64_t z = (sim_rng += 0x9E3779B97F4A7C15ULL);
+
+    z = (z ^ (z >> 30u)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27u)) * 0x94D049BB133111EBULL;
+    return (uint32_t)((z ^ (z >> 31u)) >> 32u);
+}
+
+/*****************************************************************************
+ * Function Name: Reference_Crc32
+ ******************************************************************************
+ * Summary:
+ * Bitwise CRC-32 (IEEE 802.3, reflected), the reference for the nibble
+ * table implementation.
+ *
+ * Parameters:
+ *  data   : Pointer to the data
+ *  length : Number of bytes
+ *
+ * Return:
+ *  uint32_t : CRC-32 of the data
+ *****************************************************************************/
+static uint32_t Reference_Crc32(const uint8_t *data, uint32_t length)
+{
+    uint32_t crc = 0xFFFFFFFFUL;
+
+    for (uint32_t i = 0u; i < length; i++)
+    {
+        crc ^= data[i];
+        for (uint32_t k = 0u; k < 8u; k++)
+        {
+            crc = (crc >> 1u) ^ (0xEDB88320UL & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+/*****************************************************************************
+ * Function Name: Make_Row
+ ******************************************************************************
+ * Summary:
+ * Builds a sealed row with a random number of random records, as
+ * Fault_Journal_Flush() programs it.
+ *
+ * Parameters:
+ *  row  : Row to fill
+ *  seq  : Row sequence number
+ *  boot : Boot number
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+static void Make_Row(fault_journal_row_t *row, uint32_t seq, uint16_t boot)
+{
+    memset(row, 0, sizeof(*row));
+    /* Count 0 is a boot row */
+    row->hdr.count = (uint16_t)(Sim_Random() % (FAULT_JOURNAL_RECORDS_PER_ROW + 1u));
+    for (uint32_t i = 0u; i < row->hdr.count; i++)
+    {
+        row->records[i].timestamp = Sim_Random();
+        row->records[i].detail = Sim_Random();
+        row->records[i].test_id = (uint8_t)(1u + (Sim_Random() % 15u));
+        row->records[i].status = (uint8_t)Sim_Random();
+    }
+    Fault_Journal_Seal(row, seq, boot);
+}
+
+/*****************************************************************************
+ * Function Name: Check_Crc
+ ******************************************************************************
+ * Summary:
+ * Compares the CRC with the check value of "123456789" and with the bitwise
+ * reference on random buffers of all lengths up to two rows.
+ *
+ * Parameters:
+ *  void
+ *
+ * Return:
+ *  int : Number of mismatches
+ *****************************************************************************/
+static int Check_Crc(void)
+{
+    static uint8_t buffer[2u * FAULT_JOURNAL_ROW_SIZE];
+    int errors = (0xCBF43926UL == Fault_Journal_Crc32((const uint8_t *)"123456789", 9u)) ? 0 : 1;
+
+    for (uint32_t length = 0u; length <= sizeof(buffer); length++)
+    {
+        for (uint32_t i = 0u; i < length; i++)
+        {
+            buffer[i] = (uint8_t)Sim_Random();
+        }
+        errors += (Reference_Crc32(buffer, length) == Fault_Journal_Crc32(buffer, length)) ? 0 : 1;
+    }
+
+    return errors;
+}
+
+/*****************************************************************************
+ * Function Name: Check_Row
+ ******************************************************************************
+ * Summary:
+ * A sealed row must be valid. Every single bit flip, random 2 to 8 bit
+ * flips, erased rows, random rows and a record count above the row
+ * capacity (with a correct CRC) must be rejected.
+ *
+ * Parameters:
+ *  trials : Number of random corruptions
+ *
+ * Return:
+ *  int : Number of errors
+ *****************************************************************************/
+static int Check_Row(uint32_t trials)
+{
+    fault_journal_row_t row;
+    fault_journal_row_t corrupted;
+    int errors = 0;
+
+    Make_Row(&row, Sim_Random(), (uint16_t)Sim_Random());
+    errors += Fault_Journal_RowIsValid(&row) ? 0 : 1;
+
+    for (uint32_t bit = 0u; bit < (8u * FAULT_JOURNAL_ROW_SIZE); bit++)
+    {
+        corrupted = row;
+        ((uint8_t *)&corrupted)[bit / 8u] ^= (uint8_t)(1u << (bit % 8u));
+        errors += Fault_Journal_RowIsValid(&corrupted) ? 1 : 0;
+    }
+
+    for (uint32_t t = 0u; t < trials; t++)
+    {
+        const uint32_t flips = 2u + (Sim_Random() % 7u);
+
+        Make_Row(&row, Sim_Random(), (uint16_t)Sim_Random());
+        corrupted = row;
+        for (uint32_t f = 0u; f < flips; f++)
+        {
+            const uint32_t bit = Sim_Random() % (8u * FAULT_JOURNAL_ROW_SIZE);
+            ((uint8_t *)&corrupted)[bit / 8u] ^= (uint8_t)(1u << (bit % 8u));
+        }
+        if ((0 != memcmp(&row, &corrupted, sizeof(row))) && Fault_Journal_RowIsValid(&corrupted))
+        {
+            errors++;
+        }
+
+        for (uint32_t i = 0u; i < FAULT_JOURNAL_ROW_SIZE; i++)
+        {
+            ((uint8_t *)&corrupted)[i] = (uint8_t)Sim_Random();
+        }
+        errors += Fault_Journal_RowIsValid(&corrupted) ? 1 : 0;
+    }
+
+    memset(&corrupted, 0xFF, sizeof(corrupted));
+    errors += Fault_Journal_RowIsValid(&corrupted) ? 1 : 0;
+    memset(&corrupted, 0x00, sizeof(corrupted));
+    errors += Fault_Journal_RowIsValid(&corrupted) ? 1 : 0;
+
+    Make_Row(&row, 1u, 1u);
+    row.hdr.count = (uint16_t)(FAULT_JOURNAL_RECORDS_PER_ROW + 1u);
+    Fault_Journal_Seal(&row, 1u, 1u);
+    errors += Fault_Journal_RowIsValid(&row) ? 1 : 0;
+
+    return errors;
+}
+
+/*****************************************************************************
+ * Function Name: Check_Lookup
+ ******************************************************************************
+ * Summary:
+ * Checks Fault_Journal_FindHead() and Fault_Journal_RowAt() against the
+ * model: the head must be the newest intact row, and every row returned
+ * must be byte-equal to the row programmed into its slot. Rows that are
+ * torn or corrupted must never be returned.
+ *
+ * Parameters:
+ *  expected_head : Newest intact row of the current lap, or NO_ROW
+ *  strict        : true if every intact row of the model must be found
+ *
+ * Return:
+ *  int : Number of errors
+ *****************************************************************************/
+static int Check_Lookup(uint32_t expected_head, bool strict)
+{
+    const uint32_t head = Fault_Journal_FindHead(sim_rows);
+    int errors = 0;
+
+    if ((FAULT_JOURNAL_NO_ROW != head) &&
+        ((head >= FAULT_JOURNAL_ROW_COUNT) || !Fault_Journal_RowIsValid(&sim_rows[head])))
+    {
+        return 1;
+    }
+    if (strict && (head != expected_head))
+    {
+        return 1;
+    }
+    if (FAULT_JOURNAL_NO_ROW == head)
+    {
+        return 0;
+    }
+
+    for (uint32_t age = 0u; age <= FAULT_JOURNAL_ROW_COUNT; age++)
+    {
+        const fault_journal_row_t *row = Fault_Journal_RowAt(sim_rows, head, age);
+        const uint32_t slot = (head + FAULT_JOURNAL_ROW_COUNT - (age % FAULT_JOURNAL_ROW_COUNT)) % FAULT_JOURNAL_ROW_COUNT;
+
+        if (NULL == row)
+        {
+            /* Intact rows of the current lap must be found */
+            if (strict && (age < FAULT_JOURNAL_ROW_COUNT) && model_valid[slot] &&
+                (0 == memcmp(&sim_rows[slot], &model_rows[slot], sizeof(sim_rows[slot]))) &&
+                (model_rows[slot].hdr.seq == (sim_rows[head].hdr.seq - age)))
+            {
+                errors++;
+            }
+            continue;
+        }
+        if ((age >= FAULT_JOURNAL_ROW_COUNT) || (row != &sim_rows[slot]) || !model_valid[slot] ||
+            (0 != memcmp(row, &model_rows[slot], sizeof(*row))) || (row->hdr.seq != (sim_rows[head].hdr.seq - age)))
+        {
+            errors++;
+        }
+    }
+
+    return errors;
+}
+
+/*****************************************************************************
+ * Function Name: Check_Ring
+ ******************************************************************************
+ * Summary:
+ * Programs a random number of rows (up to three laps) from a random start
+ * sequence number into an erased region, optionally followed by a torn
+ * write (a random prefix of the next row) and random bit flips in older
+ * rows, and checks the head search and the row lookup.
+ *
+ * Parameters:
+ *  trials : Number of simulated journals
+ *
+ * Return:
+ *  int : Number of failed trials
+ *****************************************************************************/
+static int Check_Ring(uint32_t trials)
+{
+    int failed = 0;
+
+    for (uint32_t t = 0u; t < trials; t++)
+    {
+        const uint32_t written = Sim_Random() % (3u * FAULT_JOURNAL_ROW_COUNT);
+        const uint32_t mode = Sim_Random() % 3u;    /* 0: clean, 1: torn write, 2: corrupted */
+        /* Half of the journals start close to the sequence number wrap */
+        uint32_t seq = (0u != (Sim_Random() & 1u)) ? (0u - (Sim_Random() % (4u * FAULT_JOURNAL_ROW_COUNT))) : Sim_Random();
+        uint32_t expected_head = FAULT_JOURNAL_NO_ROW;
+        uint32_t next = 0u;
+        uint16_t boot = 0u;
+
+        memset(sim_rows, (0u != (Sim_Random() & 1u)) ? 0xFF : 0x00, sizeof(sim_rows));
+        memset(model_valid, 0, sizeof(model_valid));
+
+        for (uint32_t n = 0u; n < written; n++)
+        {
+            boot = (uint16_t)(boot + (((Sim_Random() % 4u) == 0u) ? 1u : 0u));
+            Make_Row(&model_rows[next], seq++, boot);
+            sim_rows[next] = model_rows[next];
+            model_valid[next] = true;
+            expected_head = next;
+            next = (next + 1u) % FAULT_JOURNAL_ROW_COUNT;
+        }
+
+        if (1u == mode)
+        {
+            /* Programming interrupted after a random number of bytes */
+            fault_journal_row_t torn;
+            const uint32_t prefix = 1u + (Sim_Random() % (FAULT_JOURNAL_ROW_SIZE - 1u));
+
+            Make_Row(&torn, seq, boot);
+            memcpy(&sim_rows[next], &torn, prefix);
+            if (0 == memcmp(&sim_rows[next], &torn, sizeof(torn)))
+            {
+                model_rows[next] = torn;
+                model_valid[next] = true;
+                expected_head = next;
+            }
+        }
+        else if ((2u == mode) && (0u != written))
+        {
+            const uint32_t flips = 1u + (Sim_Random() % 8u);
+            const uint32_t slot = Sim_Random() % FAULT_JOURNAL_ROW_COUNT;
+
+            for (uint32_t f = 0u; f < flips; f++)
+            {
+                const uint32_t bit = Sim_Random() % (8u * FAULT_JOURNAL_ROW_SIZE);
+                ((uint8_t *)&sim_rows[slot])[bit / 8u] ^= (uint8_t)(1u << (bit % 8u));
+            }
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        /* A corrupted row may hide the newer rows of the lap, but no
+         * corrupted row may ever be returned */
+        if (0u != Check_Lookup(expected_head, (2u != mode)))
+        {
+            failed++;
+        }
+    }
+
+    return failed;
+}
+
+/*****************************************************************************
+ * Function Name: Check_Garbage
+ ******************************************************************************
+ * Summary:
+ * Fills the region with random bytes and sealed rows with random sequence
+ * numbers. The head search must return NO_ROW or a valid row, and the
+ * lookup must only return valid rows.
+ *
+ * Parameters:
+ *  trials : Number of random regions
+ *
+ * Return:
+ *  int : Number of failed trials
+ *****************************************************************************/
+static int Check_Garbage(uint32_t trials)
+{
+    int failed = 0;
+
+    for (uint32_t t = 0u; t < trials; t++)
+    {
+        const uint32_t base = Sim_Random();
+        uint32_t head;
+
+        for (uint32_t r = 0u; r < FAULT_JOURNAL_ROW_COUNT; r++)
+        {
+            const uint32_t kind = Sim_Random() % 3u;
+
+            if (0u == kind)
+            {
+                for (uint32_t i = 0u; i < FAULT_JOURNAL_ROW_SIZE; i++)
+                {
+                    ((uint8_t *)&sim_rows[r])[i] = (uint8_t)Sim_Random();
+                }
+            }
+            else
+            {
+                /* Sequence numbers close to a valid lap, or arbitrary */
+                Make_Row(&sim_rows[r], (1u == kind) ? (base + r + (Sim_Random() % 3u) - 1u) : Sim_Random(), 0u);
+            }
+        }
+
+        head = Fault_Journal_FindHead(sim_rows);
+        if (FAULT_JOURNAL_NO_ROW != head)
+        {
+            if ((head >= FAULT_JOURNAL_ROW_COUNT) || !Fault_Journal_RowIsValid(&sim_rows[head]))
+            {
+                failed++;
+                continue;
+            }
+            for (uint32_t age = 0u; age < FAULT_JOURNAL_ROW_COUNT; age++)
+            {
+                const fault_journal_row_t *row = Fault_Journal_RowAt(sim_rows, head, age);
+
+                if ((NULL != row) && (!Fault_Journal_RowIsValid(row) || (row->hdr.seq != (sim_rows[head].hdr.seq - age))))
+                {
+                    failed++;
+                    break;
+                }
+            }
+        }
+    }
+
+    return failed;
+}
+
+/*****************************************************************************
+ * Function Name: main
+ ******************************************************************************
+ * Summary:
+ * Usage: fault_journal_fuzz [-n trials] [-s seed] [-o image.bin]
+ * With -o, the region of the last simulated journal (including the two
+ * record rows, erased) is written for tools/fault_journal_decode.py.
+ *
+ * Return:
+ *  int : 0 if all checks pass, 1 otherwise
+ *****************************************************************************/
+int main(int argc, char *argv[])
+{
+    uint32_t trials = 20000u;
+    const char *image = NULL;
+    int crc_errors;
+    int row_errors;
+    int ring_errors;
+    int garbage_errors;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((0 == strcmp(argv[i], "-n")) && ((i + 1) < argc))
+        {
+            trials = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if ((0 == strcmp(argv[i], "-s")) && ((i + 1) < argc))
+        {
+            sim_rng = strtoull(argv[++i], NULL, 0);
+        }
+        else if ((0 == strcmp(argv[i], "-o")) && ((i + 1) < argc))
+        {
+            image = argv[++i];
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-n trials] [-s seed] [-o image.bin]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    crc_errors = Check_Crc();
+    row_errors = Check_Row(trials);
+    garbage_errors = Check_Garbage(trials / 10u);
+    ring_errors = Check_Ring(trials);
+
+    fprintf(stderr, "crc mismatches: %d\n", crc_errors);
+    fprintf(stderr, "corrupted rows accepted: %d\n", row_errors);
+    fprintf(stderr, "random region failures: %d of %u\n", garbage_errors, (unsigned)(trials / 10u));
+    fprintf(stderr, "ring failures: %d of %u\n", ring_errors, (unsigned)trials);
+
+    if (NULL != image)
+    {
+        FILE *out = fopen(image, "wb");
+        static uint8_t erased[FAULT_JOURNAL_SIZE - sizeof(sim_rows)];
+
+        if (NULL == out)
+        {
+            perror(image);
+            return 1;
+        }
+        memset(erased, 0xFF, sizeof(erased));
+        (void)fwrite(sim_rows, sizeof(sim_rows), 1u, out);
+        (void)fwrite(erased, sizeof(erased), 1u, out);
+        (void)fclose(out);
+    }
+
+    return ((0 == crc_errors) && (0 == row_errors) && (0 == ring_errors) && (0 == garbage_errors)) ? 0 : 1;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,752 @@
+/******************************************************************************
+ * File Name:   fault_sim.c
+ *
+ * Description: Host fault injection simulator for the memory and checksum
+ * self tests. Runs reference models of the March C- and GALPAT SRAM tests
+ * and of the CRC-32 and Fletcher-64 flash checksums over simulated memories
+ * with injected faults, and reports the coverage and the detection latency
+ * of every algorithm and slice size. Campaigns run on all host cores.
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+/* Simulated SRAM and flash sizes, in 32-bit words */
+#define SRAM_WORDS              (512u)
+#define FLASH_WORDS             (16384u)
+
+/* Cost model, CPU cycles per operation. Calibrate against the cycles measured
+ * on target (binary telemetry records) for the configuration in use. */
+#define CYCLES_SRAM_READ        (3u)    /* Load, compare and branch */
+#define CYCLES_SRAM_WRITE       (2u)
+#define CYCLES_SRAM_SAVE        (4u)    /* Save and restore of a word to the buffer */
+#define CYCLES_CRC32_WORD       (18u)   /* Table driven, 4 bytes */
+#define CYCLES_FLETCHER64_WORD  (6u)
+
+#define MAX_THREADS             (256u)
+#define ALL_ONES                (0xFFFFFFFFUL)
+
+/*******************************************************************************
+ * Data Types
+ *******************************************************************************/
+typedef enum
+{
+    FAULT_STUCK_AT_0 = 0,       /* Bit reads 0 */
+    FAULT_STUCK_AT_1,           /* Bit reads 1 */
+    FAULT_TRANSITION_UP,        /* Bit cannot change from 0 to 1 */
+    FAULT_TRANSITION_DOWN,      /* Bit cannot change from 1 to 0 */
+    FAULT_COUPLING,             /* Transition of an aggressor bit forces a victim bit */
+    FAULT_MULTI_BIT,            /* 2 to 4 bits of a word stuck */
+    FAULT_SRAM_TYPES,
+    FAULT_FLIP_1 = FAULT_SRAM_TYPES,    /* Flash: one flipped bit */
+    FAULT_FLIP_MULTI,           /* Flash: 2 to 4 flipped bits in one word */
+    FAULT_BURST,                /* Flash: 2 to 8 consecutive words corrupted */
+    FAULT_WORD_ERASED,          /* Flash: word reads all 0 or all 1 */
+    FAULT_TYPES
+} fault_type_t;
+
+typedef enum
+{
+    ALG_MARCH = 0,
+    ALG_GALPAT,
+    ALG_CRC32,
+    ALG_FLETCHER64,
+    ALG_COUNT
+} algorithm_t;
+
+typedef struct
+{
+    fault_type_t type;
+    uint32_t word;              /* Faulty (victim) word */
+    uint32_t mask;              /* Faulty bits */
+    uint32_t value;             /* Stuck or forced value of the faulty bits */
+    uint32_t aggressor_word;    /* Coupling fault aggressor */
+    uint32_t aggressor_mask;
+    bool     aggressor_rise;    /* Rising (true) or falling transition triggers */
+} fault_t;
+
+typedef struct
+{
+    uint32_t cells[SRAM_WORDS];
+    fault_t  fault;
+    uint64_t cycles;
+} sim_sram_t;
+
+typedef struct
+{
+    algorithm_t  algorithm;
+    uint32_t     slice_words;
+    fault_type_t fault;
+} campaign_t;
+
+typedef struct
+{
+    uint64_t trials;
+    uint64_t detected;
+    uint64_t cycles_sum;        /* Detection latency of the detected faults */
+    uint64_t cycles_max;
+    uint64_t slices_sum;
+    uint64_t slices_max;
+} result_t;
+
+/*******************************************************************************
+ * Global Variables
+ *******************************************************************************/
+static const char *fault_names[FAULT_TYPES] =
+{
+    "stuck-at-0", "stuck-at-1", "transition-up", "transition-down", "coupling", "multi-bit",
+    "flip-1", "flip-multi", "burst", "word-erased"
+};
+static const char *algorithm_names[ALG_COUNT] = { "MARCH", "GALPAT", "CRC32", "FLETCHER64" };
+
+static const uint32_t sram_slices[] = { 32u, 128u, 512u };
+static const uint32_t flash_slices[] = { 64u, 256u, 1024u };
+
+static campaign_t campaigns[64];
+static uint32_t campaign_count = 0u;
+static uint32_t trials_per_campaign = 2000u;
+static uint64_t seed = 1u;
+
+static atomic_uint_fast64_t next_trial;
+static result_t (*thread_results)[64];
+
+static uint32_t flash_image[FLASH_WORDS];
+static uint32_t flash_crc32;
+static uint64_t flash_fletcher64;
+
+/*******************************************************************************
+ * Function Definitions
+ *******************************************************************************/
+
+/*****************************************************************************
+ * Function Name: Rand64
+ ******************************************************************************
+ * Summary:
+ * splitmix64 generator. Every trial has its own state derived from the seed,
+ * campaign and trial number, so results do not depend on the thread count.
+ *****************************************************************************/
+static uint64_t Rand64(uint64_t *state)
+{
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30u)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27u)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31u);
+}
+
+static uint32_t Rand_Below(uint64_t *state, uint32_t limit)
+{
+    return (uint32_t)(Rand64(state) % limit);
+}
+
+static uint32_t Rand_Bits(uint64_t *state, uint32_t count)
+{
+    uint32_t mask = 0u;
+    while ((uint32_t)__builtin_popcount(mask) < count)
+    {
+        mask |= 1UL << Rand_Below(state, 32u);
+    }
+    return mask;
+}
+
+/*****************************************************************************
+ * Function Name: Sram_Write / Sram_Read
+ ******************************************************************************
+ * Summary:
+ * Simulated SRAM access with the injected fault applied.
+ *****************************************************************************/
+static void Sram_Write(sim_sram_t *mem, uint32_t addr, uint32_t value)
+{
+    const fault_t *f = &mem->fault;
+    const uint32_t old = mem->cells[addr];
+
+    mem->cycles += CYCLES_SRAM_WRITE;
+
+    if (addr == f->word)
+    {
+        switch (f->type)
+        {
+            case FAULT_STUCK_AT_0:
+            case FAULT_STUCK_AT_1:
+            case FAULT_MULTI_BIT:
+                value = (value & ~f->mask) | (f->value & f->mask);
+                break;
+            case FAULT_TRANSITION_UP:
+                value &= ~(f->mask & ~old);
+                break;
+            case FAULT_TRANSITION_DOWN:
+                value |= f->mask & old;
+                break;
+            default:
+                break;
+        }
+    }
+    mem->cells[addr] = value;
+
+    if ((FAULT_COUPLING == f->type) && (addr == f->aggressor_word))
+    {
+        const uint32_t changed = (old ^ value) & f->aggressor_mask;
+        const bool rose = (0u != (value & f->aggressor_mask));
+
+        if ((0u != changed) && (rose == f->aggressor_rise))
+        {
+            mem->cells[f->word] = (mem->cells[f->word] & ~f->mask) | (f->value & f->mask);
+        }
+    }
+}
+
+static uint32_t Sram_Read(sim_sram_t *mem, uint32_t addr)
+{
+    mem->cycles += CYCLES_SRAM_READ;
+    return mem->cells[addr];
+}
+
+/*****************************************************************************
+ * Function Name: March_Block
+ ******************************************************************************
+ * Summary:
+ * March C- over one block: up(w0); up(r0,w1); up(r1,w0); down(r0,w1);
+ * down(r1,w0); any(r0), with all-0 / all-1 word backgrounds, framed by the
+ * save and restore of the block like SelfTest_SRAM().
+ *
+ * Return:
+ *  bool : true if a fault was detected
+ *****************************************************************************/
+static bool March_Block(sim_sram_t *mem, uint32_t start, uint32_t words)
+{
+    const uint32_t end = start + words;
+
+    mem->cycles += (uint64_t)words * CYCLES_SRAM_SAVE;
+
+    for (uint32_t a = start; a < end; a++)
+    {
+        Sram_Write(mem, a, 0u);
+    }
+    for (uint32_t a = start; a < end; a++)
+    {
+        if (0u != Sram_Read(mem, a)) { return true; }
+        Sram_Write(mem, a, ALL_ONES);
+    }
+    for (uint32_t a = start; a < end; a++)
+    {
+        if (ALL_ONES != Sram_Read(mem, a)) { return true; }
+        Sram_Write(mem, a, 0u);
+    }
+    for (uint32_t a = end; a-- > start;)
+    {
+        if (0u != Sram_Read(mem, a)) { return true; }
+        Sram_Write(mem, a, ALL_ONES);
+    }
+    for (uint32_t a = end; a-- > start;)
+    {
+        if (ALL_ONES != Sram_Read(mem, a)) { return true; }
+        Sram_Write(mem, a, 0u);
+    }
+    for (uint32_t a = start; a < end; a++)
+    {
+        if (0u != Sram_Read(mem, a)) { return true; }
+    }
+
+    return false;
+}
+
+/*****************************************************************************
+ * Function Name: Galpat_Block
+ ******************************************************************************
+ * Summary:
+ * GALPAT over one block: for both backgrounds, every word in turn is
+ * complemented, all other words and the test word are read back, and the
+ * test word is restored.
+ *
+ * Return:
+ *  bool : true if a fault was detected
+ *****************************************************************************/
+static bool Galpat_Block(sim_sram_t *mem, uint32_t start, uint32_t words)
+{
+    const uint32_t end = start + words;
+
+    mem->cycles += (uint64_t)words * CYCLES_SRAM_SAVE;
+
+    for (uint32_t pass = 0u; pass < 2u; pass++)
+    {
+        const uint32_t background = (0u == pass) ? 0u : ALL_ONES;
+
+        for (uint32_t a = start; a < end; a++)
+        {
+            Sram_Write(mem, a, background);
+        }
+        for (uint32_t i = start; i < end; i++)
+        {
+            Sram_Write(mem, i, ~background);
+            for (uint32_t j = start; j < end; j++)
+            {
+                if ((j != i) && (background != Sram_Read(mem, j))) { return true; }
+                if (~background != Sram_Read(mem, i)) { return true; }
+            }
+            Sram_Write(mem, i, background);
+        }
+    }
+
+    return false;
+}
+
+/*****************************************************************************
+ * Function Name: Inject_Sram_Fault
+ ******************************************************************************
+ * Summary:
+ * Fills the simulated SRAM with random data and injects a random fault of
+ * the given type.
+ *****************************************************************************/
+static void Inject_Sram_Fault(sim_sram_t *mem, fault_type_t type, uint64_t *rng)
+{
+    fault_t *f = &mem->fault;
+
+    for (uint32_t a = 0u; a < SRAM_WORDS; a++)
+    {
+        mem->cells[a] = (uint32_t)Rand64(rng);
+    }
+
+    memset(f, 0, sizeof(*f));
+    f->type = type;
+    f->word = Rand_Below(rng, SRAM_WORDS);
+    f->mask = Rand_Bits(rng, 1u);
+
+    switch (type)
+    {
+        case FAULT_STUCK_AT_0:
+            f->value = 0u;
+            break;
+        case FAULT_STUCK_AT_1:
+            f->value = ALL_ONES;
+            break;
+        case FAULT_MULTI_BIT:
+            f->mask = Rand_Bits(rng, 2u + Rand_Below(rng, 3u));
+            f->value = (uint32_t)Rand64(rng);
+            break;
+        case FAULT_COUPLING:
+            do
+            {
+                f->aggressor_word = Rand_Below(rng, SRAM_WORDS);
+            } while (f->aggressor_word == f->word);
+            f->aggressor_mask = Rand_Bits(rng, 1u);
+            f->aggressor_rise = (0u != (Rand64(rng) & 1u));
+            f->value = (0u != (Rand64(rng) & 1u)) ? ALL_ONES : 0u;
+            break;
+        default:
+            break;
+    }
+
+    /* Stuck bits are stuck from the start */
+    if ((FAULT_STUCK_AT_0 == type) || (FAULT_STUCK_AT_1 == type) || (FAULT_MULTI_BIT == type))
+    {
+        mem->cells[f->word] = (mem->cells[f->word] & ~f->mask) | (f->value & f->mask);
+    }
+    mem->cycles = 0u;
+}
+
+/*****************************************************************************
+ * Function Name: Run_Sram_Trial
+ ******************************************************************************
+ * Summary:
+ * Runs the sliced SRAM test over the whole simulated SRAM until the fault is
+ * detected, starting at a random slice (the fault may appear at any time).
+ *****************************************************************************/
+static void Run_Sram_Trial(const campaign_t *c, uint64_t *rng, result_t *r)
+{
+    static _Thread_local sim_sram_t mem;
+    const uint32_t slices = SRAM_WORDS / c->slice_words;
+    const uint32_t first = Rand_Below(rng, slices);
+
+    Inject_Sram_Fault(&mem, c->fault, rng);
+    r->trials++;
+
+    for (uint32_t n = 1u; n <= slices; n++)
+    {
+        const uint32_t start = ((first + n - 1u) % slices) * c->slice_words;
+        const bool detected = (ALG_MARCH == c->algorithm) ? March_Block(&mem, start, c->slice_words)
+                                                          : Galpat_Block(&mem, start, c->slice_words);
+        if (detected)
+        {
+            r->detected++;
+            r->cycles_sum += mem.cycles;
+            r->slices_sum += n;
+            r->cycles_max = (mem.cycles > r->cycles_max) ? mem.cycles : r->cycles_max;
+            r->slices_max = (n > r->slices_max) ? n : r->slices_max;
+            return;
+        }
+    }
+}
+
+/*****************************************************************************
+ * Function Name: Crc32 / Fletcher64
+ ******************************************************************************
+ * Summary:
+ * Reference flash checksums: CRC-32 (IEEE 802.3) and Fletcher-64 over 32-bit
+ * words (sums modulo 2^32 - 1).
+ *****************************************************************************/
+static uint32_t Crc32(const uint32_t *words, uint32_t count)
+{
+    uint32_t crc = ALL_ONES;
+
+    for (uint32_t i = 0u; i < count; i++)
+    {
+        for (uint32_t b = 0u; b < 4u; b++)
+        {
+            crc ^= (words[i] >> (8u * b)) & 0xFFu;
+            for (uint32_t k = 0u; k < 8u; k++)
+            {
+                crc = (crc >> 1u) ^ (0xEDB88320UL & (0u - (crc & 1u)));
+            }
+        }
+    }
+    return ~crc;
+}
+
+static uint64_t Fletcher64(const uint32_t *words, uint32_t count)
+{
+    uint64_t sum1 = 0u;
+    uint64_t sum2 = 0u;
+
+    for (uint32_t i = 0u; i < count; i++)
+    {
+        sum1 = (sum1 + words[i]) % ALL_ONES;
+        sum2 = (sum2 + sum1) % ALL_ONES;
+    }
+    return (sum2 << 32u) | sum1;
+}
+
+/*****************************************************************************
+ * Function Name: Run_Flash_Trial
+ ******************************************************************************
+ * Summary:
+ * Corrupts a copy of the flash image and recalculates the checksum. The
+ * checksum is only compared at the end of a pass, so a fault appearing at a
+ * random slice is detected at the end of the pass after the one it appears
+ * in, if the slice was already passed.
+ *****************************************************************************/
+static void Run_Flash_Trial(const campaign_t *c, uint64_t *rng, result_t *r)
+{
+    static _Thread_local uint32_t image[FLASH_WORDS];
+    const uint32_t slices = FLASH_WORDS / c->slice_words;
+    const uint64_t cycles_per_word = (ALG_CRC32 == c->algorithm) ? CYCLES_CRC32_WORD : CYCLES_FLETCHER64_WORD;
+    const uint32_t word = Rand_Below(rng, FLASH_WORDS);
+    const uint32_t appear = Rand_Below(rng, slices);
+    bool detected;
+
+    memcpy(image, flash_image, sizeof(image));
+    r->trials++;
+
+    switch (c->fault)
+    {
+        case FAULT_FLIP_1:
+            image[word] ^= Rand_Bits(rng, 1u);
+            break;
+        case FAULT_FLIP_MULTI:
+            image[word] ^= Rand_Bits(rng, 2u + Rand_Below(rng, 3u));
+            break;
+        case FAULT_BURST:
+        {
+            const uint32_t length = 2u + Rand_Below(rng, 7u);
+            for (uint32_t i = 0u; (i < length) && ((word + i) < FLASH_WORDS); i++)
+            {
+                image[word + i] = (uint32_t)Rand64(rng);
+            }
+            break;
+        }
+        case FAULT_WORD_ERASED:
+            image[word] = (0u != (Rand64(rng) & 1u)) ? ALL_ONES : 0u;
+            break;
+        default:
+            break;
+    }
+
+    detected = (ALG_CRC32 == c->algorithm) ? (Crc32(image, FLASH_WORDS) != flash_crc32)
+                                           : (Fletcher64(image, FLASH_WORDS) != flash_fletcher64);
+    if (detected)
+    {
+        /* Slices from the fault to the end of the pass it is caught in */
+        const uint64_t n = (((word / c->slice_words) >= appear) ? 0u : slices) + (slices - appear);
+        const uint64_t cycles = n * c->slice_words * cycles_per_word;
+
+        r->detected++;
+        r->cycles_sum += cycles;
+        r->slices_sum += n;
+        r->cycles_max = (cycles > r->cycles_max) ? cycles : r->cycles_max;
+        r->slices_max = (n > r->slices_max) ? n : r->slices_max;
+    }
+}
+
+/*****************************************************************************
+ * Function Name: Worker
+ ******************************************************************************
+ * Summary:
+ * Takes trials from the shared counter until all campaigns are done.
+ *****************************************************************************/
+static void *Worker(void *arg)
+{
+    result_t *results = (result_t *)arg;
+    const uint64_t total = (uint64_t)campaign_count * trials_per_campaign;
+
+    for (;;)
+    {
+        const uint64_t trial = atomic_fetch_add(&next_trial, 1u);
+        const campaign_t *c;
+        uint64_t rng;
+
+        if (trial >= total)
+        {
+            break;
+        }
+
+        c = &campaigns[trial / trials_per_campaign];
+        rng = seed ^ (trial * 0xD1B54A32D192ED03ULL);
+        (void)Rand64(&rng);
+
+        if (c->algorithm <= ALG_GALPAT)
+        {
+            Run_Sram_Trial(c, &rng, &results[trial / trials_per_campaign]);
+        }
+        else
+        {
+            Run_Flash_Trial(c, &rng, &results[trial / trials_per_campaign]);
+        }
+    }
+
+    return NULL;
+}
+
+/*****************************************************************************
+ * Function Name: Run_Perf
+ ******************************************************************************
+ * Summary:
+ * Runs every algorithm and slice size on fault-free memories and prints the
+ * model cycles per slice in the result line format of the target benchmark
+ * (perf_bench.h), for tools/perf_compare.py. The SRAM tests run with
+ * interrupts disabled on target, so their interrupt-off time is the slice.
+ *****************************************************************************/
+static void Run_Perf(uint32_t iterations)
+{
+    static sim_sram_t mem;
+
+    memset(&mem, 0, sizeof(mem));
+    for (uint32_t alg = ALG_MARCH; alg < ALG_COUNT; alg++)
+    {
+        const bool sram = (alg <= ALG_GALPAT);
+        const uint32_t *sizes = sram ? sram_slices : flash_slices;
+        const uint32_t size_count = sram ? (sizeof(sram_slices) / sizeof(sram_slices[0]))
+                                         : (sizeof(flash_slices) / sizeof(flash_slices[0]));
+
+        for (uint32_t s = 0u; s < size_count; s++)
+        {
+            const uint32_t words = sizes[s];
+            uint64_t min = UINT64_MAX;
+            uint64_t max = 0u;
+            uint64_t sum = 0u;
+            uint32_t failures = 0u;
+
+            for (uint32_t i = 0u; i < iterations; i++)
+            {
+                const uint32_t start = (i % ((sram ? SRAM_WORDS : FLASH_WORDS) / words)) * words;
+                uint64_t cycles;
+
+                if (sram)
+                {
+                    const bool detected = (ALG_MARCH == alg) ? March_Block(&mem, start, words)
+                                                             : Galpat_Block(&mem, start, words);
+                    failures += detected ? 1u : 0u;
+                    cycles = mem.cycles;
+                    mem.cycles = 0u;
+                }
+                else
+                {
+                    /* Result kept live so the checksum is not optimized away */
+                    failures += ((ALG_CRC32 == alg) ? (Crc32(&flash_image[start], words) == 0u)
+                                                    : (Fletcher64(&flash_image[start], words) == 0u)) ? 1u : 0u;
+                    cycles = (uint64_t)words * ((ALG_CRC32 == alg) ? CYCLES_CRC32_WORD : CYCLES_FLETCHER64_WORD);
+                }
+                min = (cycles < min) ? cycles : min;
+                max = (cycles > max) ? cycles : max;
+                sum += cycles;
+            }
+
+            printf("PERF,model %s %u B,%u,%llu,%llu,%llu,%u,%llu,%u\n",
+                   algorithm_names[alg], words * 4u, iterations, (unsigned long long)min,
+                   (unsigned long long)(sum / iterations), (unsigned long long)max, words * 4u,
+                   sram ? (unsigned long long)max : 0ULL, failures);
+        }
+    }
+}
+
+/*****************************************************************************
+ * Function Name: main
+ ******************************************************************************
+ * Summary:
+ * Usage: fault_sim [-j threads] [-n trials per campaign] [-s seed] [-p iterations]
+ * Prints one CSV line per algorithm, slice size and fault type, or with -p,
+ * one benchmark result line per algorithm and slice size.
+ *****************************************************************************/
+int main(int argc, char *argv[])
+{
+    pthread_t threads[MAX_THREADS];
+    long thread_count = sysconf(_SC_NPROCESSORS_ONLN);
+    uint32_t perf_iterations = 0u;
+    uint64_t rng;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((0 == strcmp(argv[i], "-j")) && ((i + 1) < argc))
+        {
+            thread_count = strtol(argv[++i], NULL, 0);
+        }
+        else if ((0 == strcmp(argv[i], "-n")) && ((i + 1) < argc))
+        {
+            trials_per_campaign = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if ((0 == strcmp(argv[i], "-s")) && ((i + 1) < argc))
+        {
+            seed = strtoull(argv[++i], NULL, 0);
+        }
+        else if ((0 == strcmp(argv[i], "-p")) && ((i + 1) < argc))
+        {
+            perf_iterations = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-j threads] [-n trials per campaign] [-s seed] [-p iterations]\n", argv[0]);
+            return 1;
+        }
+    }
+    if ((thread_count < 1) || (thread_count > (long)MAX_THREADS) || (0u == trials_per_campaign))
+    {
+        fprintf(stderr, "bad thread or trial count\n");
+        return 1;
+    }
+
+    /* Campaigns: every algorithm x slice size x applicable fault type */
+    for (uint32_t alg = ALG_MARCH; alg <= ALG_GALPAT; alg++)
+    {
+        for (uint32_t s = 0u; s < (sizeof(sram_slices) / sizeof(sram_slices[0])); s++)
+        {
+            for (uint32_t f = 0u; f < FAULT_SRAM_TYPES; f++)
+            {
+                campaigns[campaign_count++] = (campaign_t){ (algorithm_t)alg, sram_slices[s], (fault_type_t)f };
+            }
+        }
+    }
+    for (uint32_t alg = ALG_CRC32; alg <= ALG_FLETCHER64; alg++)
+    {
+        for (uint32_t s = 0u; s < (sizeof(flash_slices) / sizeof(flash_slices[0])); s++)
+        {
+            for (uint32_t f = FAULT_SRAM_TYPES; f < FAULT_TYPES; f++)
+            {
+                campaigns[campaign_count++] = (campaign_t){ (algorithm_t)alg, flash_slices[s], (fault_type_t)f };
+            }
+        }
+    }
+
+    rng = seed;
+    for (uint32_t i = 0u; i < FLASH_WORDS; i++)
+    {
+        flash_image[i] = (uint32_t)Rand64(&rng);
+    }
+    flash_crc32 = Crc32(flash_image, FLASH_WORDS);
+    flash_fletcher64 = Fletcher64(flash_image, FLASH_WORDS);
+
+    if (0u != perf_iterations)
+    {
+        Run_Perf(perf_iterations);
+        return 0;
+    }
+
+    thread_results = calloc((size_t)thread_count, sizeof(*thread_results));
+    if (NULL == thread_results)
+    {
+        return 1;
+    }
+    atomic_init(&next_trial, 0u);
+    for (long t = 0; t < thread_count; t++)
+    {
+        pthread_create(&threads[t], NULL, Worker, thread_results[t]);
+    }
+    for (long t = 0; t < thread_count; t++)
+    {
+        pthread_join(threads[t], NULL);
+    }
+
+    printf("algorithm,slice_bytes,fault,trials,coverage_pct,mean_cycles,max_cycles,mean_slices,max_slices\n");
+    for (uint32_t i = 0u; i < campaign_count; i++)
+    {
+        result_t total = { 0 };
+
+        for (long t = 0; t < thread_count; t++)
+        {
+            const result_t *r = &thread_results[t][i];
+            total.trials += r->trials;
+            total.detected += r->detected;
+            total.cycles_sum += r->cycles_sum;
+            total.slices_sum += r->slices_sum;
+            total.cycles_max = (r->cycles_max > total.cycles_max) ? r->cycles_max : total.cycles_max;
+            total.slices_max = (r->slices_max > total.slices_max) ? r->slices_max : total.slices_max;
+        }
+
+        printf("%s,%u,%s,%llu,%.2f,%.0f,%llu,%.1f,%llu\n",
+               algorithm_names[campaigns[i].algorithm], campaigns[i].slice_words * 4u,
+               fault_names[campaigns[i].fault], (unsigned long long)total.trials,
+               (100.0 * total.detected) / total.trials,
+               (0u != total.detected) ? ((double)total.cycles_sum / total.detected) : 0.0,
+               (unsigned long long)total.cycles_max,
+               (0u != total.detected) ? ((double)total.slices_sum / total.detected) : 0.0,
+               (unsigned long long)total.slices_max);
+    }
+
+    free(thread_results);
+    return 0;
+}
+
+
+/* [] END OF FILE */
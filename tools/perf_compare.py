@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+################################################################################
+# \file perf_compare.py
+# \version 1.0
+#
+# \brief
+# Compares benchmark result lines (PERF,..., see source/perf_bench.h) with
+# the cycle budgets in perf_budgets.csv and fails when a test got slower or
+# keeps interrupts off longer than its budget plus a tolerance. A test
+# without a budget fails until --update stores one.
+#
+# Host model results:
+#   tools/build/fault_sim -p 64 > perf_host.txt
+#   python3 perf_compare.py perf_budgets.csv perf_host.txt --source host
+# Target results, from the console log of a PERF_BENCH=1 build:
+#   python3 perf_compare.py perf_budgets.csv uart.log --source target --irq-slack 1800
+#   python3 perf_compare.py perf_budgets.csv uart.log --source target --update
+#
+################################################################################
+# \copyright
+# Copyright 2025, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import argparse
+import csv
+import sys
+
+# Must match PERF_BENCH_TAG and the result line format of source/perf_bench.h
+PERF_TAG = "PERF"
+RESULT_FIELDS = ["test", "iterations", "min_cycles", "mean_cycles", "max_cycles",
+                 "bytes", "irq_off_cycles", "failures"]
+BUDGET_FIELDS = ["source", "test", "mean_cycles", "max_cycles", "irq_off_cycles"]
+
+
+def read_results(path):
+    """Returns the result lines of a log, by test name. Other lines are
+    ignored, so the whole console log can be passed."""
+    results = {}
+    with open(path, "r", errors="replace") as log:
+        for line in log:
+            fields = line.strip().split(",")
+            if fields[0] != PERF_TAG or len(fields) != len(RESULT_FIELDS) + 1:
+                continue
+            try:
+                result = dict(zip(RESULT_FIELDS[1:], (int(f) for f in fields[2:])))
+            except ValueError:
+                continue
+            result["test"] = fields[1]
+            results[fields[1]] = result
+    return results
+
+
+def read_budgets(path):
+    with open(path, "r", newline="") as budgets:
+        return list(csv.DictReader(budgets))
+
+
+def check(budget, result, tolerance, irq_slack):
+    """Returns the list of budget violations of one test."""
+    errors = []
+    if result["failures"]:
+        errors.append("%d failed slices" % result["failures"])
+    for field in ("mean_cycles", "max_cycles", "irq_off_cycles"):
+        if not budget[field]:
+            continue
+        limit = int(budget[field]) * (1.0 + tolerance / 100.0)
+        if field == "irq_off_cycles":
+            limit += irq_slack
+        if result[field] > limit:
+            errors.append("%s %d > %d" % (field, result[field], int(budget[field])))
+    return errors
+
+
+def update(path, budgets, source, results):
+    """Rewrites the budgets of one source with the measured values. Tests
+    without a budget are added; results with failed slices are not stored."""
+    known = set(budget["test"] for budget in budgets if budget["source"] == source)
+    for test in results:
+        if test not in known:
+            budgets.append({"source": source, "test": test})
+    for budget in budgets:
+        result = results.get(budget["test"]) if budget["source"] == source else None
+        if result and result["failures"]:
+            sys.stderr.write("%s: %d failed slices, budget not stored\n" % (budget["test"], result["failures"]))
+        elif result:
+            for field in ("mean_cycles", "max_cycles", "irq_off_cycles"):
+                budget[field] = result[field]
+    with open(path, "w", newline="") as out:
+        writer = csv.DictWriter(out, fieldnames=BUDGET_FIELDS, lineterminator="\n")
+        writer.writeheader()
+        writer.writerows(budgets)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Benchmark budget check")
+    parser.add_argument("budgets", help="budget file, perf_budgets.csv")
+    parser.add_argument("results", help="benchmark output or console log")
+    parser.add_argument("--source", choices=("host", "target"), default="host",
+                        help="budgets to check the results against")
+    parser.add_argument("--tolerance", type=float, default=10.0,
+                        help="allowed increase in percent (default 10)")
+    parser.add_argument("--irq-slack", type=int, default=0,
+                        help="cycles added to the interrupt-off budgets, "
+                             "the resolution of the target measurement")
+    parser.add_argument("--update", action="store_true",
+                        help="store the results as the new budgets")
+    args = parser.parse_args()
+
+    budgets = read_budgets(args.budgets)
+    results = read_results(args.results)
+
+    if args.update:
+        update(args.budgets, budgets, args.source, results)
+        return 0
+
+    failed = 0
+    print("%-28s %10s %10s %10s %12s  %s" % ("test", "mean", "max", "irq_off", "bytes/cycle", "status"))
+    budgets = [budget for budget in budgets if budget["source"] == args.source]
+    known = set(budget["test"] for budget in budgets)
+    rows = [(budget["test"], budget) for budget in budgets]
+    rows += [(test, None) for test in results if test not in known]
+    for test, budget in rows:
+        result = results.get(test)
+        if result is None:
+            errors = ["no result"]
+            result = dict.fromkeys(RESULT_FIELDS[1:], 0)
+        elif (budget is None) or not budget["max_cycles"]:
+            errors = ["no budget, measure one with --update"]
+        else:
+            errors = check(budget, result, args.tolerance, args.irq_slack)
+        per_cycle = (float(result["bytes"]) / result["mean_cycles"]) if result["mean_cycles"] else 0.0
+        print("%-28s %10d %10d %10d %12.4f  %s" % (
+            test, result["mean_cycles"], result["max_cycles"],
+            result["irq_off_cycles"], per_cycle, "; ".join(errors) if errors else "ok"))
+        failed += 1 if errors else 0
+
+    if failed:
+        sys.stderr.write("%d test(s) over or without budget (tolerance %.1f %%)\n" % (failed, args.tolerance))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
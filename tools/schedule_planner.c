@@ -0,0 +1,244 @@
+/******************************************************************************
+ * File Name:   schedule_planner.c
+ *
+ * Description: Host build of the diagnostic test interval planner. Plans the
+ * periodic tests of source/test_schedule_cfg.h (or of a CSV file), reports
+ * the tick load, and prints the schedule as a constant C table that the
+ * target uses when built with DEFINES+=TEST_SCHEDULE_CONST_TABLE.
+ *
+ *
+ * Related Document: See README.md
+ *
+ *
+ *******************************************************************************
+ * Copyright 2025, Cypress Semiconductor Corporation (an Infineon company) or
+ * an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+ *
+ * This software, including source code, documentation and related
+ * materials ("Software") is owned by Cypress Semiconductor Corporation
+ * or one of its affiliates ("Cypress") and is protected by and subject to
+ * worldwide patent protection (United States and foreign),
+ * United States copyright laws and international treaty provisions.
+ * Therefore, you may use this Software only as provided in the license
+ * agreement accompanying the software package from which you
+ * obtained this Software ("EULA").
+ * If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+ * non-transferable license to copy, modify, and compile the Software
+ * source code solely for use in connection with Cypress's
+ * integrated circuit products.  Any reproduction, modification, translation,
+ * compilation, or representation of this Software except as specified
+ * above is prohibited without the express written permission of Cypress.
+ *
+ * Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+ * reserves the right to make changes to the Software without notice. Cypress
+ * does not assume any liability arising out of the application or use of the
+ * Software or any product or circuit described in the Software. Cypress does
+ * not authorize its products for use in any products where a malfunction or
+ * failure of the Cypress product may reasonably be expected to result in
+ * significant property damage, injury or death ("High Risk Product"). By
+ * including Cypress's product in a High Risk Product, the manufacturer
+ * of such system or application assumes all risk of such use and in doing
+ * so agrees to indemnify Cypress against all liability.
+ *******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test_schedule.h"
+#include "test_schedule_cfg.h"
+
+/*******************************************************************************
+ * Macros
+ *******************************************************************************/
+#define LINE_LENGTH     (256u)
+#define NAME_LENGTH     (40u)
+
+/*******************************************************************************
+ * Global Variables
+ *******************************************************************************/
+#define PLANNER_TASK_ENTRY(name, func, id, slices, cycles, period, irq_off, irq_limit, bytes) \
+        { (name), NULL, (id), (slices), (cycles), (period), (irq_off), (irq_limit) },
+static test_task_t tasks[TEST_SCHEDULE_MAX_TASKS] =
+{
+    TEST_SCHEDULE_TASKS(PLANNER_TASK_ENTRY)
+};
+#define PLANNER_TASK_COUNT_ONE(name, func, id, slices, cycles, period, irq_off, irq_limit, bytes) + 1u
+#define PLANNER_TASK_COUNT (0u TEST_SCHEDULE_TASKS(PLANNER_TASK_COUNT_ONE))
+typedef char planner_task_count_check[(PLANNER_TASK_COUNT <= TEST_SCHEDULE_MAX_TASKS) ? 1 : -1];
+static char task_names[TEST_SCHEDULE_MAX_TASKS][NAME_LENGTH];
+static test_schedule_plan_t plan;
+
+static const char *status_text[] =
+{
+    "ok", "bad task parameter", "schedule too long", "interrupt-off limit exceeded", "tick budget exceeded"
+};
+
+/*******************************************************************************
+ * Function Definitions
+ *******************************************************************************/
+
+/*****************************************************************************
+ * Function Name: Load_Csv
+ ******************************************************************************
+ * Summary:
+ * Reads the task table from a CSV file with the columns
+ * name,test_id,slices,slice_cycles,period_ticks,irq_off_cycles,irq_off_limit
+ * Lines starting with '#' are ignored.
+ *
+ * Parameters:
+ *  path : CSV file
+ *
+ * Return:
+ *  int : Number of tasks, or -1 on error
+ *****************************************************************************/
+static int Load_Csv(const char *path)
+{
+    char line[LINE_LENGTH];
+    int count = 0;
+    FILE *file = fopen(path, "r");
+
+    if (NULL == file)
+    {
+        perror(path);
+        return -1;
+    }
+
+    while (NULL != fgets(line, sizeof(line), file))
+    {
+        unsigned id, slices, cycles, period, irq_off, irq_limit;
+
+        if (('#' == line[0]) || ('\n' == line[0]))
+        {
+            continue;
+        }
+        if (count >= (int)TEST_SCHEDULE_MAX_TASKS)
+        {
+            fprintf(stderr, "%s: more than %u tasks\n", path, TEST_SCHEDULE_MAX_TASKS);
+            count = -1;
+            break;
+        }
+        if (7 != sscanf(line, "%39[^,],%u,%u,%u,%u,%u,%u", task_names[count], &id, &slices,
+                        &cycles, &period, &irq_off, &irq_limit))
+        {
+            fprintf(stderr, "%s: bad line: %s", path, line);
+            count = -1;
+            break;
+        }
+        tasks[count] = (test_task_t){ task_names[count], NULL, (uint8_t)id, (uint16_t)slices, cycles,
+                                      (uint16_t)period, irq_off, irq_limit };
+        count++;
+    }
+
+    fclose(file);
+    return count;
+}
+
+/*****************************************************************************
+ * Function Name: Print_Table
+ ******************************************************************************
+ * Summary:
+ * Prints the schedule as a C source file. The entries refer to the tasks by
+ * their position, so the file also checks at compile time that the
+ * firmware table TEST_SCHEDULE_TASKS has the same number of tasks and the
+ * same test index at every position.
+ *
+ * Parameters:
+ *  out   : Output stream
+ *  count : Number of tasks the schedule was planned for
+ *
+ * Return:
+ *  void
+ *****************************************************************************/
+static void Print_Table(FILE *out, int count)
+{
+    fprintf(out, "/* Generated by tools/schedule_planner, do not edit. */\n");
+    fprintf(out, "#include \"test_schedule.h\"\n#include \"test_schedule_cfg.h\"\n\n");
+    fprintf(out, "/* Position of every test index in TEST_SCHEDULE_TASKS */\n");
+    fprintf(out, "#define TEST_SCHEDULE_TABLE_POS(name, func, id, slices, cycles, period, irq_off, irq_limit, bytes) \\\n"
+                 "        TEST_SCHEDULE_TABLE_POS_##id,\n");
+    fprintf(out, "enum\n{\n    TEST_SCHEDULE_TASKS(TEST_SCHEDULE_TABLE_POS)\n    TEST_SCHEDULE_TABLE_TASKS\n};\n\n");
+    fprintf(out, "/* Tasks this table was planned for */\n");
+    fprintf(out, "typedef char test_schedule_table_count_check[(TEST_SCHEDULE_TABLE_TASKS == %d) ? 1 : -1];\n", count);
+    for (int i = 0; i < count; i++)
+    {
+        fprintf(out, "typedef char test_schedule_table_task%d_check[(TEST_SCHEDULE_TABLE_POS_%uu == %d) ? 1 : -1];\n",
+                i, tasks[i].test_id, i);
+    }
+    fprintf(out, "\n");
+    fprintf(out, "const test_schedule_plan_t test_schedule_table =\n{\n");
+    fprintf(out, "    .ticks = %uu,\n    .entry_count = %uu,\n    .peak_cycles = %uu,\n",
+            plan.ticks, plan.entry_count, (unsigned)plan.peak_cycles);
+    fprintf(out, "    .tick_start =\n    {");
+    for (unsigned i = 0u; i <= plan.ticks; i++)
+    {
+        fprintf(out, "%s%uu,", (0u == (i % 12u)) ? "\n        " : " ", plan.tick_start[i]);
+    }
+    fprintf(out, "\n    },\n    .entries =\n    {");
+    for (unsigned i = 0u; i < plan.entry_count; i++)
+    {
+        fprintf(out, "%s%uu,", (0u == (i % 16u)) ? "\n        " : " ", plan.entries[i]);
+    }
+    fprintf(out, "\n    },\n};\n");
+}
+
+/*****************************************************************************
+ * Function Name: main
+ ******************************************************************************
+ * Summary:
+ * Usage: schedule_planner [-b tick_budget_cycles] [-c tasks.csv]
+ *
+ * Return:
+ *  int : 0 if the schedule meets all constraints, 1 otherwise
+ *****************************************************************************/
+int main(int argc, char *argv[])
+{
+    uint32_t budget = TEST_SCHEDULE_TICK_BUDGET;
+    int count = (int)PLANNER_TASK_COUNT;
+    test_schedule_status_t status;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((0 == strcmp(argv[i], "-b")) && ((i + 1) < argc))
+        {
+            budget = (uint32_t)strtoul(argv[++i], NULL, 0);
+        }
+        else if ((0 == strcmp(argv[i], "-c")) && ((i + 1) < argc))
+        {
+            count = Load_Csv(argv[++i]);
+            if (count <= 0)
+            {
+                return 1;
+            }
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-b tick_budget_cycles] [-c tasks.csv]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    status = Test_Schedule_Plan(tasks, (uint8_t)count, budget, &plan);
+    if (TEST_SCHEDULE_OK != status)
+    {
+        fprintf(stderr, "Not feasible: %s (task \"%s\")\n", status_text[status], tasks[plan.failed_task].name);
+        return 1;
+    }
+
+    fprintf(stderr, "%d tasks, %u slices in %u ticks of %u ms, peak load %u of %u cycles (%.1f %% CPU)\n",
+            count, plan.entry_count, plan.ticks, TEST_SCHEDULE_TICK_MS, (unsigned)plan.peak_cycles,
+            (unsigned)budget, (100.0 * plan.peak_cycles) / TEST_SCHEDULE_TICK_CYCLES);
+    for (int i = 0; i < count; i++)
+    {
+        fprintf(stderr, "  %-24s every %5u ms, %3u slice(s)\n", tasks[i].name,
+                tasks[i].period_ticks * TEST_SCHEDULE_TICK_MS, tasks[i].slices);
+    }
+
+    Print_Table(stdout, count);
+    return 0;
+}
+
+
+/* [] END OF FILE */
@@ -0,0 +1,256 @@
+#!/usr/bin/env python3
+################################################################################
+# \file telemetry_decode.py
+# \version 1.0
+#
+# \brief
+# Decoder and recorder for the binary telemetry stream of the debug UART
+# (TELEMETRY_MODE == TELEMETRY_BINARY, see source/telemetry.h).
+#
+# Live capture (requires pyserial), recording the raw stream for replay:
+#   python3 telemetry_decode.py --port /dev/ttyACM0 --record capture.bin
+# Replay of a captured stream:
+#   python3 telemetry_decode.py capture.bin --format json
+#
+################################################################################
+# \copyright
+# Copyright 2025, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+import argparse
+import csv
+import json
+import os
+import re
+import sys
+
+# Must match source/telemetry.h
+TYPE_RESULT = 1
+TYPE_COUNTER = 2
+COUNTER_NAMES = {
+    0: "stalls",
+    1: "journal_dropped",
+    2: "tests",
+    3: "wakeups",
+    4: "test_wakeups",
+    5: "shared_wakeups",
+    6: "awake_cycles",
+    7: "startup_cycles",
+    8: "snapshot_writes",
+}
+
+SOURCE_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "source")
+
+# Tests that only run at start-up and have no entry in TEST_SCHEDULE_TASKS
+STARTUP_ONLY_TESTS = {
+    5: "Watchdog Test", 6: "GPIO Test", 8: "DMA DW Test", 10: "Clock Test",
+    11: "Interrupt Test",
+}
+
+FIELDS = ["seq", "type", "test_id", "test", "status", "iteration", "cycles",
+          "detail", "counter", "value"]
+
+
+def x_macro_rows(path, name):
+    """Returns the argument lists of the X() rows of an X-macro table."""
+    with open(path, encoding="utf-8") as header:
+        text = header.read()
+    match = re.search(r"#define\s+%s\(X\)((?:.*\\\n)*.*)" % name, text)
+    if match is None:
+        raise ValueError("%s not found in %s" % (name, path))
+    return [[arg.strip() for arg in row.split(",")]
+            for row in re.findall(r"X\((.*?)\)\s*(?:\\|$)", match.group(1), re.M)]
+
+
+def c_uint(token):
+    return int(token.rstrip("uUlL"), 0)
+
+
+def load_test_names(source_dir):
+    """Test index to name, from the periodic test table and the clock monitor
+    sources of the firmware configuration headers."""
+    names = dict(STARTUP_ONLY_TESTS)
+    for row in x_macro_rows(os.path.join(source_dir, "test_schedule_cfg.h"),
+                            "TEST_SCHEDULE_TASKS"):
+        names[c_uint(row[2])] = row[0].strip('"')
+    monitor_cfg = os.path.join(source_dir, "clock_monitor_cfg.h")
+    with open(monitor_cfg, encoding="utf-8") as header:
+        first = re.search(r"#define\s+CLOCK_MONITOR_TEST_ID\s+\((\w+)\)", header.read())
+    for index, row in enumerate(x_macro_rows(monitor_cfg, "CLOCK_MONITOR_SOURCES")):
+        names[c_uint(first.group(1)) + index] = "Clock Monitor " + row[0].strip('"')
+    return names
+
+
+def crc16(data):
+    """CRC-16/CCITT-FALSE, same as Telemetry_Crc16()."""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def cobs_decode(data):
+    """Returns the decoded frame, or None if the COBS encoding is broken."""
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data):
+            return None
+        out += data[i + 1:i + code]
+        i += code
+        if code != 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def read_varint(data, pos):
+    value = 0
+    shift = 0
+    while True:
+        if pos >= len(data) or shift > 28:
+            raise ValueError("truncated varint")
+        byte = data[pos]
+        value |= (byte & 0x7F) << shift
+        pos += 1
+        shift += 7
+        if not byte & 0x80:
+            return value, pos
+
+
+def parse_frame(frame, test_names):
+    """Returns a record dict, or None for corrupted frames."""
+    payload = cobs_decode(frame)
+    if payload is None or len(payload) < 3:
+        return None
+    body, crc = payload[:-2], payload[-2] | (payload[-1] << 8)
+    if crc16(body) != crc:
+        return None
+    kind, seq = body[0] >> 5, body[0] & 0x1F
+    try:
+        if kind == TYPE_RESULT and len(body) >= 3:
+            iteration, pos = read_varint(body, 3)
+            cycles, pos = read_varint(body, pos)
+            detail, pos = read_varint(body, pos)
+            return {"seq": seq, "type": "result", "test_id": body[1],
+                    "test": test_names.get(body[1], ""), "status": body[2],
+                    "iteration": iteration, "cycles": cycles,
+                    "detail": "0x%08X" % detail}
+        if kind == TYPE_COUNTER and len(body) >= 2:
+            value, pos = read_varint(body, 2)
+            return {"seq": seq, "type": "counter",
+                    "counter": COUNTER_NAMES.get(body[1], str(body[1])),
+                    "value": value}
+    except ValueError:
+        return None
+    return None
+
+
+class Decoder:
+    """Splits the byte stream at 0x00 delimiters and decodes the frames."""
+
+    def __init__(self, on_record, on_text, test_names):
+        self.chunk = bytearray()
+        self.test_names = test_names
+        self.on_record = on_record
+        self.on_text = on_text
+        self.last_seq = None
+        self.lost = 0
+        self.bad = 0
+
+    def feed(self, data):
+        for byte in data:
+            if byte != 0:
+                self.chunk.append(byte)
+                continue
+            if self.chunk:
+                self._frame(bytes(self.chunk))
+            self.chunk.clear()
+
+    def _frame(self, frame):
+        record = parse_frame(frame, self.test_names)
+        if record is None:
+            text = frame.decode("ascii", "replace")
+            if text.isprintable() or "\r" in text or "\n" in text:
+                self.on_text(text)
+            else:
+                self.bad += 1
+            return
+        if self.last_seq is not None:
+            self.lost += (record["seq"] - self.last_seq - 1) & 0x1F
+        self.last_seq = record["seq"]
+        self.on_record(record)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Telemetry stream decoder")
+    parser.add_argument("capture", nargs="?", help="captured raw stream to replay")
+    parser.add_argument("--port", help="serial port for live capture")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--record", help="file to store the raw stream in")
+    parser.add_argument("--format", choices=("csv", "json"), default="csv")
+    parser.add_argument("--source", default=SOURCE_DIR,
+                        help="firmware source directory the test names are read from")
+    args = parser.parse_args()
+
+    if not args.capture and not args.port:
+        parser.error("either a capture file or --port is required")
+
+    if args.format == "csv":
+        writer = csv.DictWriter(sys.stdout, fieldnames=FIELDS)
+        writer.writeheader()
+        on_record = writer.writerow
+    else:
+        def on_record(record):
+            sys.stdout.write(json.dumps(record) + "\n")
+
+    def on_text(text):
+        sys.stderr.write(text.strip("\r\n") + "\n")
+
+    decoder = Decoder(on_record, on_text, load_test_names(args.source))
+    record_file = open(args.record, "wb") if args.record else None
+
+    try:
+        if args.port:
+            import serial  # pyserial, only needed for live capture
+            with serial.Serial(args.port, args.baud, timeout=0.1) as port:
+                while True:
+                    data = port.read(4096)
+                    if record_file:
+                        record_file.write(data)
+                    decoder.feed(data)
+                    sys.stdout.flush()
+        else:
+            with open(args.capture, "rb") as capture:
+                data = capture.read()
+            if record_file:
+                record_file.write(data)
+            decoder.feed(data + b"\x00")
+    except KeyboardInterrupt:
+        pass
+    finally:
+        if record_file:
+            record_file.close()
+
+    sys.stderr.write("frames lost: %d, corrupted: %d\n" % (decoder.lost, decoder.bad))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())